@@ -0,0 +1,139 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bench/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/entity/CMakeLists.txt"
+  "/root/repo/test/signal/CMakeLists.txt"
+  "/root/repo/test/system/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/entity/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/signal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/system/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/entity.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/sparse_set.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/storage.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/mixin.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/registry.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/observer.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/runtime_view.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/stats.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/entity_pool.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/archetype.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/soa_storage.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/hierarchy.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/spatial_hash.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/hash_index.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/ordered_index.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/tag_storage.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/condition.dir/DependInfo.cmake"
+  "test/entity/CMakeFiles/query.dir/DependInfo.cmake"
+  "test/signal/CMakeFiles/delegate.dir/DependInfo.cmake"
+  "test/signal/CMakeFiles/sink.dir/DependInfo.cmake"
+  "test/signal/CMakeFiles/dispatcher.dir/DependInfo.cmake"
+  "test/system/CMakeFiles/scheduler.dir/DependInfo.cmake"
+  "bench/CMakeFiles/run_benchmark.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_entity.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_storage.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_registry.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_view.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_signal.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_scheduler.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_archetype.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_hierarchy.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_spatial_hash.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_hash_index.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_ordered_index.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_tag_storage.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_condition.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_query.dir/DependInfo.cmake"
+  "bench/CMakeFiles/bench_view_scalar.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_archetype.dir/archetype.cpp.o"
+  "CMakeFiles/bench_archetype.dir/archetype.cpp.o.d"
+  "bench_archetype"
+  "bench_archetype.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_archetype.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
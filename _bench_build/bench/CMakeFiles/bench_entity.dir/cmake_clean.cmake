@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_entity.dir/entity.cpp.o"
+  "CMakeFiles/bench_entity.dir/entity.cpp.o.d"
+  "bench_entity"
+  "bench_entity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_entity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
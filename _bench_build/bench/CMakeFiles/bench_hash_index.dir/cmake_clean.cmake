@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_hash_index.dir/hash_index.cpp.o"
+  "CMakeFiles/bench_hash_index.dir/hash_index.cpp.o.d"
+  "bench_hash_index"
+  "bench_hash_index.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_hash_index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
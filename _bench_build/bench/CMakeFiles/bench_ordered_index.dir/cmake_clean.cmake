@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_ordered_index.dir/ordered_index.cpp.o"
+  "CMakeFiles/bench_ordered_index.dir/ordered_index.cpp.o.d"
+  "bench_ordered_index"
+  "bench_ordered_index.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_ordered_index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_scheduler.dir/scheduler.cpp.o"
+  "CMakeFiles/bench_scheduler.dir/scheduler.cpp.o.d"
+  "bench_scheduler"
+  "bench_scheduler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_scheduler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_signal.dir/signal.cpp.o"
+  "CMakeFiles/bench_signal.dir/signal.cpp.o.d"
+  "bench_signal"
+  "bench_signal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_signal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_spatial_hash.dir/spatial_hash.cpp.o"
+  "CMakeFiles/bench_spatial_hash.dir/spatial_hash.cpp.o.d"
+  "bench_spatial_hash"
+  "bench_spatial_hash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_spatial_hash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
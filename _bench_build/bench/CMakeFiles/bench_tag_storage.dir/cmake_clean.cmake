@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_tag_storage.dir/tag_storage.cpp.o"
+  "CMakeFiles/bench_tag_storage.dir/tag_storage.cpp.o.d"
+  "bench_tag_storage"
+  "bench_tag_storage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_tag_storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
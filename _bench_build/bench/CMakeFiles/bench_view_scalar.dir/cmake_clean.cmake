@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_view_scalar.dir/view.cpp.o"
+  "CMakeFiles/bench_view_scalar.dir/view.cpp.o.d"
+  "bench_view_scalar"
+  "bench_view_scalar.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_view_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/archetype.dir/archetype.cpp.o"
+  "CMakeFiles/archetype.dir/archetype.cpp.o.d"
+  "archetype"
+  "archetype.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/archetype.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/condition.dir/condition.cpp.o"
+  "CMakeFiles/condition.dir/condition.cpp.o.d"
+  "condition"
+  "condition.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/condition.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
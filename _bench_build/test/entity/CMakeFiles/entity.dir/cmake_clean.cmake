@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/entity.dir/entity.cpp.o"
+  "CMakeFiles/entity.dir/entity.cpp.o.d"
+  "entity"
+  "entity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/entity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
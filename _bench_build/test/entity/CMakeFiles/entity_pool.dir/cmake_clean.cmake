@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/entity_pool.dir/entity_pool.cpp.o"
+  "CMakeFiles/entity_pool.dir/entity_pool.cpp.o.d"
+  "entity_pool"
+  "entity_pool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/entity_pool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash_index.dir/hash_index.cpp.o"
+  "CMakeFiles/hash_index.dir/hash_index.cpp.o.d"
+  "hash_index"
+  "hash_index.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_index.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
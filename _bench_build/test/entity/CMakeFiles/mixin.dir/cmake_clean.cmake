@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mixin.dir/mixin.cpp.o"
+  "CMakeFiles/mixin.dir/mixin.cpp.o.d"
+  "mixin"
+  "mixin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mixin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
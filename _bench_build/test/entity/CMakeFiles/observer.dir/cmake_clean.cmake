@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/observer.dir/observer.cpp.o"
+  "CMakeFiles/observer.dir/observer.cpp.o.d"
+  "observer"
+  "observer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/observer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/query.dir/query.cpp.o"
+  "CMakeFiles/query.dir/query.cpp.o.d"
+  "query"
+  "query.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/query.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/registry.dir/registry.cpp.o"
+  "CMakeFiles/registry.dir/registry.cpp.o.d"
+  "registry"
+  "registry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/registry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
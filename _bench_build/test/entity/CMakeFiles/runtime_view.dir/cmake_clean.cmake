@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/runtime_view.dir/runtime_view.cpp.o"
+  "CMakeFiles/runtime_view.dir/runtime_view.cpp.o.d"
+  "runtime_view"
+  "runtime_view.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/runtime_view.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
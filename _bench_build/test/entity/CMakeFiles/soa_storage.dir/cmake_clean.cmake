@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/soa_storage.dir/soa_storage.cpp.o"
+  "CMakeFiles/soa_storage.dir/soa_storage.cpp.o.d"
+  "soa_storage"
+  "soa_storage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/soa_storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sparse_set.dir/sparse_set.cpp.o"
+  "CMakeFiles/sparse_set.dir/sparse_set.cpp.o.d"
+  "sparse_set"
+  "sparse_set.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sparse_set.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
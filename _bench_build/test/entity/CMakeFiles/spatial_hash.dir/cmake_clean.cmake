@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spatial_hash.dir/spatial_hash.cpp.o"
+  "CMakeFiles/spatial_hash.dir/spatial_hash.cpp.o.d"
+  "spatial_hash"
+  "spatial_hash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spatial_hash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
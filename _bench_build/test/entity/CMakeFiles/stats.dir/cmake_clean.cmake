@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stats.dir/stats.cpp.o"
+  "CMakeFiles/stats.dir/stats.cpp.o.d"
+  "stats"
+  "stats.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
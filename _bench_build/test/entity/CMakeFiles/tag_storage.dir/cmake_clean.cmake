@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tag_storage.dir/tag_storage.cpp.o"
+  "CMakeFiles/tag_storage.dir/tag_storage.cpp.o.d"
+  "tag_storage"
+  "tag_storage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tag_storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
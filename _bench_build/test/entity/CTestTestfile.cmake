@@ -0,0 +1,42 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/entity
+# Build directory: /root/repo/_bench_build/test/entity
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[entity]=] "/root/repo/_bench_build/test/entity/entity")
+set_tests_properties([=[entity]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;1;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[sparse_set]=] "/root/repo/_bench_build/test/entity/sparse_set")
+set_tests_properties([=[sparse_set]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;2;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[storage]=] "/root/repo/_bench_build/test/entity/storage")
+set_tests_properties([=[storage]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;3;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[mixin]=] "/root/repo/_bench_build/test/entity/mixin")
+set_tests_properties([=[mixin]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;4;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[registry]=] "/root/repo/_bench_build/test/entity/registry")
+set_tests_properties([=[registry]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;5;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[observer]=] "/root/repo/_bench_build/test/entity/observer")
+set_tests_properties([=[observer]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;6;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[runtime_view]=] "/root/repo/_bench_build/test/entity/runtime_view")
+set_tests_properties([=[runtime_view]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;7;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[stats]=] "/root/repo/_bench_build/test/entity/stats")
+set_tests_properties([=[stats]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;8;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[entity_pool]=] "/root/repo/_bench_build/test/entity/entity_pool")
+set_tests_properties([=[entity_pool]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;9;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[archetype]=] "/root/repo/_bench_build/test/entity/archetype")
+set_tests_properties([=[archetype]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;10;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[soa_storage]=] "/root/repo/_bench_build/test/entity/soa_storage")
+set_tests_properties([=[soa_storage]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;11;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[hierarchy]=] "/root/repo/_bench_build/test/entity/hierarchy")
+set_tests_properties([=[hierarchy]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;12;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[spatial_hash]=] "/root/repo/_bench_build/test/entity/spatial_hash")
+set_tests_properties([=[spatial_hash]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;13;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[hash_index]=] "/root/repo/_bench_build/test/entity/hash_index")
+set_tests_properties([=[hash_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;14;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[ordered_index]=] "/root/repo/_bench_build/test/entity/ordered_index")
+set_tests_properties([=[ordered_index]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;15;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[tag_storage]=] "/root/repo/_bench_build/test/entity/tag_storage")
+set_tests_properties([=[tag_storage]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;16;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[condition]=] "/root/repo/_bench_build/test/entity/condition")
+set_tests_properties([=[condition]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;17;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
+add_test([=[query]=] "/root/repo/_bench_build/test/entity/query")
+set_tests_properties([=[query]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/entity/CMakeLists.txt;18;AddTest;/root/repo/test/entity/CMakeLists.txt;0;")
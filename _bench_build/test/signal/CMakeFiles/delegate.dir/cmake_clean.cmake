@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/delegate.dir/delegate.cpp.o"
+  "CMakeFiles/delegate.dir/delegate.cpp.o.d"
+  "delegate"
+  "delegate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/delegate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dispatcher.dir/dispatcher.cpp.o"
+  "CMakeFiles/dispatcher.dir/dispatcher.cpp.o.d"
+  "dispatcher"
+  "dispatcher.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dispatcher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sink.dir/sink.cpp.o"
+  "CMakeFiles/sink.dir/sink.cpp.o.d"
+  "sink"
+  "sink.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sink.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
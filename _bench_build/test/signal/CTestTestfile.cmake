@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/signal
+# Build directory: /root/repo/_bench_build/test/signal
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[delegate]=] "/root/repo/_bench_build/test/signal/delegate")
+set_tests_properties([=[delegate]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/signal/CMakeLists.txt;1;AddTest;/root/repo/test/signal/CMakeLists.txt;0;")
+add_test([=[sink]=] "/root/repo/_bench_build/test/signal/sink")
+set_tests_properties([=[sink]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/signal/CMakeLists.txt;2;AddTest;/root/repo/test/signal/CMakeLists.txt;0;")
+add_test([=[dispatcher]=] "/root/repo/_bench_build/test/signal/dispatcher")
+set_tests_properties([=[dispatcher]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/signal/CMakeLists.txt;3;AddTest;/root/repo/test/signal/CMakeLists.txt;0;")
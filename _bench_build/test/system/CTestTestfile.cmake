@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/system
+# Build directory: /root/repo/_bench_build/test/system
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[scheduler]=] "/root/repo/_bench_build/test/system/scheduler")
+set_tests_properties([=[scheduler]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;4;add_test;/root/repo/test/system/CMakeLists.txt;1;AddTest;/root/repo/test/system/CMakeLists.txt;0;")
@@ -0,0 +1,88 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Health {
+    int value;
+};
+
+// every entity owns Position, Velocity and Health
+template <typename Registry>
+std::vector<entity> populate(Registry& registry, size_t count) {
+    std::vector<entity> entities(count);
+    for (size_t i = 0; i < count; i++) {
+        entities[i] = registry.create();
+        registry.template emplace<Position>(entities[i], 1.f, 2.f);
+        registry.template emplace<Velocity>(entities[i], 1.f, 2.f);
+        registry.template emplace<Health>(entities[i], 100);
+    }
+    return entities;
+}
+
+void integrate(Position& position, const Velocity& velocity) {
+    position.x += velocity.x;
+    position.y += velocity.y;
+}
+
+int main(int argc, char** argv) {
+    const auto counts = bench::counts();
+    bench::Suite suite;
+
+    suite.add("archetype/iterate/sparse_set", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate(registry, count);
+        timer.start();
+        for (auto [entity, position, velocity] : registry.view<Position, Velocity>()) {
+            integrate(position, velocity);
+        }
+        timer.stop();
+    });
+
+    suite.add("archetype/iterate/archetype", counts, [](bench::Timer& timer, size_t count) {
+        archetype_registry registry;
+        populate(registry, count);
+        timer.start();
+        registry.view<Position, Velocity>().each([](entity, Position& position, Velocity& velocity) {
+            integrate(position, velocity);
+        });
+        timer.stop();
+    });
+
+    // structural change: every entity gains a component and loses it again
+    suite.add("archetype/add_remove/sparse_set", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto entities = populate(registry, count);
+        timer.start();
+        for (auto entity : entities) {
+            registry.emplace<int>(entity, 0);
+        }
+        for (auto entity : entities) {
+            registry.remove<int>(entity);
+        }
+        timer.stop();
+    });
+
+    suite.add("archetype/add_remove/archetype", counts, [](bench::Timer& timer, size_t count) {
+        archetype_registry registry;
+        auto entities = populate(registry, count);
+        timer.start();
+        for (auto entity : entities) {
+            registry.emplace<int>(entity, 0);
+        }
+        for (auto entity : entities) {
+            registry.remove<int>(entity);
+        }
+        timer.stop();
+    });
+
+    return bench::run(suite, argc, argv);
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace wecs::bench {
+
+class Timer {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    void start() noexcept {
+        begin_ = clock_type::now();
+    }
+
+    void stop() noexcept {
+        elapsed_ += clock_type::now() - begin_;
+    }
+
+    double elapsed() const noexcept {
+        return std::chrono::duration<double, std::nano>(elapsed_).count();
+    }
+
+private:
+    clock_type::time_point begin_{};
+    clock_type::duration elapsed_{};
+};
+
+struct Result {
+    std::string name;
+    size_t count;
+    size_t repetitions;
+    double ns_per_op;
+    double ns_total;
+};
+
+struct Options {
+    std::string format = "text";
+    std::string out;
+    std::string filter;
+    size_t max_count = std::numeric_limits<size_t>::max();
+    size_t repetitions = 5;
+};
+
+//! @brief parse --format=text|json|csv --out=path --filter=substr --max-count=N --repetitions=N
+inline Options parse(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&arg](const char* key) -> const char* {
+            const auto len = std::strlen(key);
+            return arg.compare(0, len, key) == 0 ? arg.c_str() + len : nullptr;
+        };
+        if (auto v = value("--format=")) {
+            options.format = v;
+        } else if (auto v = value("--out=")) {
+            options.out = v;
+        } else if (auto v = value("--filter=")) {
+            options.filter = v;
+        } else if (auto v = value("--max-count=")) {
+            options.max_count = std::stoull(v);
+        } else if (auto v = value("--repetitions=")) {
+            options.repetitions = std::max<size_t>(1, std::stoull(v));
+        } else {
+            std::fprintf(stderr, "unknown argument: %s\n", arg.c_str());
+        }
+    }
+    return options;
+}
+
+class Suite {
+public:
+    using function_type = std::function<void(Timer&, size_t)>;
+
+    //! @brief register a case measured once per entry of counts
+    void add(std::string name, std::vector<size_t> counts, function_type func) {
+        cases_.push_back({std::move(name), std::move(counts), std::move(func)});
+    }
+
+    //! @brief run every case, keeping the best of repetitions
+    std::vector<Result> run(const Options& options = {}) const {
+        std::vector<Result> results;
+        for (auto& elem : cases_) {
+            if (elem.name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+            for (auto count : elem.counts) {
+                if (count > options.max_count) {
+                    continue;
+                }
+                double best = std::numeric_limits<double>::max();
+                for (size_t i = 0; i < options.repetitions; i++) {
+                    Timer timer;
+                    elem.func(timer, count);
+                    best = std::min(best, timer.elapsed());
+                }
+                results.push_back({elem.name, count, options.repetitions, best / static_cast<double>(count), best});
+            }
+        }
+        return results;
+    }
+
+private:
+    struct Case {
+        std::string name;
+        std::vector<size_t> counts;
+        function_type func;
+    };
+
+    std::vector<Case> cases_;
+};
+
+inline const char* compiler() noexcept {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+}
+
+inline const char* build_type() noexcept {
+#ifdef NDEBUG
+    return "release";
+#else
+    return "debug";
+#endif
+}
+
+inline void print_text(std::FILE* file, const std::vector<Result>& results) {
+    std::fprintf(file, "%-48s %12s %14s\n", "name", "count", "ns/op");
+    for (auto& result : results) {
+        std::fprintf(file, "%-48s %12zu %14.3f\n", result.name.c_str(), result.count, result.ns_per_op);
+    }
+}
+
+inline void print_csv(std::FILE* file, const std::vector<Result>& results) {
+    std::fprintf(file, "name,count,repetitions,ns_per_op,ns_total\n");
+    for (auto& result : results) {
+        std::fprintf(file, "\"%s\",%zu,%zu,%.3f,%.1f\n", result.name.c_str(), result.count,
+                     result.repetitions, result.ns_per_op, result.ns_total);
+    }
+}
+
+inline void print_json(std::FILE* file, const std::vector<Result>& results) {
+    std::fprintf(file, "{\n  \"context\": {\n");
+    std::fprintf(file, "    \"date\": %lld,\n", static_cast<long long>(std::time(nullptr)));
+    std::fprintf(file, "    \"compiler\": \"%s\",\n", compiler());
+    std::fprintf(file, "    \"build_type\": \"%s\"\n  },\n", build_type());
+    std::fprintf(file, "  \"benchmarks\": [");
+    for (size_t i = 0; i < results.size(); i++) {
+        auto& result = results[i];
+        std::fprintf(file, "%s\n    {\"name\": \"%s\", \"count\": %zu, \"repetitions\": %zu, "
+                           "\"ns_per_op\": %.3f, \"ns_total\": %.1f}",
+                     i ? "," : "", result.name.c_str(), result.count, result.repetitions,
+                     result.ns_per_op, result.ns_total);
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+}
+
+//! @brief run suite with the command line options and write the report
+inline int run(const Suite& suite, int argc, char** argv) {
+    const auto options = parse(argc, argv);
+    const auto results = suite.run(options);
+    std::FILE* file = options.out.empty() ? stdout : std::fopen(options.out.c_str(), "w");
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", options.out.c_str());
+        return 1;
+    }
+    if (options.format == "json") {
+        print_json(file, results);
+    } else if (options.format == "csv") {
+        print_csv(file, results);
+    } else {
+        print_text(file, results);
+    }
+    if (file != stdout) {
+        std::fclose(file);
+    }
+    return 0;
+}
+
+//! @brief counts from 1k to 10M, the scale every suite is measured at
+inline std::vector<size_t> counts() {
+    return {1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+}
+
+template <typename Type>
+inline void do_not_optimize(Type&& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile auto sink = &value;
+    sink = &value;
+#endif
+}
+
+} // namespace wecs::bench
@@ -0,0 +1,93 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Player {
+    int id;
+};
+
+struct Enemy {
+    int id;
+};
+
+struct Frozen {};
+
+// every entity placed, with a mix of the other components
+void populate(registry& registry, std::vector<entity>& entities, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        auto entity = registry.create();
+        entities.push_back(entity);
+        registry.emplace<Position>(entity, 0.f, 0.f);
+        if (i % 2 == 0) {
+            registry.emplace<Velocity>(entity, 1.f, 0.f);
+        }
+        if (i % 3 == 0) {
+            registry.emplace<Player>(entity, 0);
+        } else if (i % 3 == 1) {
+            registry.emplace<Enemy>(entity, 0);
+        }
+        if (i % 5 == 0) {
+            registry.emplace<Frozen>(entity);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::vector<size_t> counts{10000, 100000};
+    bench::Suite suite;
+
+    // moving players or enemies that aren't frozen, one has per type
+    suite.add("condition/has", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        std::vector<entity> entities;
+        populate(registry, entities, count);
+        size_t matched = 0;
+        timer.start();
+        for (auto entity : entities) {
+            matched += registry.has<Position>(entity) && registry.has<Velocity>(entity) &&
+                       (registry.has<Player>(entity) || registry.has<Enemy>(entity)) && !registry.has<Frozen>(entity);
+        }
+        timer.stop();
+        bench::do_not_optimize(matched);
+    });
+
+    suite.add("condition/of", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        std::vector<entity> entities;
+        populate(registry, entities, count);
+        size_t matched = 0;
+        timer.start();
+        for (auto entity : entities) {
+            matched += registry.all_of<Position, Velocity>(entity) && registry.any_of<Player, Enemy>(entity) &&
+                       registry.none_of<Frozen>(entity);
+        }
+        timer.stop();
+        bench::do_not_optimize(matched);
+    });
+
+    suite.add("condition/condition", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        std::vector<entity> entities;
+        populate(registry, entities, count);
+        auto condition = registry.condition();
+        condition.all_of<Position, Velocity>().any_of<Player, Enemy>().none_of<Frozen>();
+        size_t matched = 0;
+        timer.start();
+        for (auto entity : entities) {
+            matched += condition(entity);
+        }
+        timer.stop();
+        bench::do_not_optimize(matched);
+    });
+
+    return bench::run(suite, argc, argv);
+}
@@ -0,0 +1,81 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+
+using namespace wecs;
+
+using free_list_registry = BasicRegistry<entity, config::page_size, SighMixin<BasicEntityPool<entity>>>;
+
+// frames of creating count entities and destroying them all again, ns/op spans every frame
+template <typename Registry>
+void churn(bench::Timer& timer, size_t count) {
+    constexpr size_t frames = 4;
+    Registry registry;
+    std::vector<entity> entities(count);
+    timer.start();
+    for (size_t frame = 0; frame < frames; frame++) {
+        for (auto& entity : entities) {
+            entity = registry.create();
+        }
+        for (auto entity : entities) {
+            registry.destroy(entity);
+        }
+    }
+    timer.stop();
+}
+
+int main(int argc, char** argv) {
+    const auto counts = bench::counts();
+    bench::Suite suite;
+
+    suite.add("entity/create", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        timer.start();
+        for (size_t i = 0; i < count; i++) {
+            bench::do_not_optimize(registry.create());
+        }
+        timer.stop();
+    });
+
+    suite.add("entity/destroy", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        std::vector<entity> entities(count);
+        for (auto& entity : entities) {
+            entity = registry.create();
+        }
+        timer.start();
+        for (auto entity : entities) {
+            registry.destroy(entity);
+        }
+        timer.stop();
+    });
+
+    suite.add("entity/recycle", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        std::vector<entity> entities(count);
+        for (auto& entity : entities) {
+            entity = registry.create();
+        }
+        for (auto entity : entities) {
+            registry.destroy(entity);
+        }
+        timer.start();
+        for (size_t i = 0; i < count; i++) {
+            bench::do_not_optimize(registry.create());
+        }
+        timer.stop();
+    });
+
+    suite.add("entity/churn/storage", counts, churn<registry>);
+    suite.add("entity/churn/free_list", counts, churn<free_list_registry>);
+
+    suite.add("entity/create/free_list", counts, [](bench::Timer& timer, size_t count) {
+        free_list_registry registry;
+        timer.start();
+        for (size_t i = 0; i < count; i++) {
+            bench::do_not_optimize(registry.create());
+        }
+        timer.stop();
+    });
+
+    return bench::run(suite, argc, argv);
+}
@@ -0,0 +1,69 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <random>
+
+using namespace wecs;
+
+struct NetworkId {
+    uint32_t value;
+};
+
+// entities with shuffled unique ids, and the ids to look up in random order
+std::vector<uint32_t> populate(registry& registry, size_t count) {
+    std::vector<uint32_t> ids(count);
+    for (size_t i = 0; i < count; i++) {
+        ids[i] = static_cast<uint32_t>(i * 7919u);
+    }
+    std::mt19937 engine{42};
+    std::shuffle(ids.begin(), ids.end(), engine);
+    for (auto id : ids) {
+        registry.emplace<NetworkId>(registry.create(), id);
+    }
+    std::shuffle(ids.begin(), ids.end(), engine);
+    return ids;
+}
+
+int main(int argc, char** argv) {
+    bench::Suite suite;
+
+    suite.add("hash_index/find/index", {1000, 100000}, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto ids = populate(registry, count);
+        auto& index = registry.unique_index<NetworkId>(&NetworkId::value);
+        timer.start();
+        for (auto id : ids) {
+            bench::do_not_optimize(index.find(id));
+        }
+        timer.stop();
+    });
+
+    // the lookup without an index: scanning the pool until the id turns up
+    suite.add("hash_index/find/scan", {1000, 10000}, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto ids = populate(registry, count);
+        timer.start();
+        for (auto id : ids) {
+            for (auto [holder, network_id] : registry.view<NetworkId>()) {
+                if (network_id.value == id) {
+                    bench::do_not_optimize(holder);
+                    break;
+                }
+            }
+        }
+        timer.stop();
+    });
+
+    // what the signals add to emplace
+    suite.add("hash_index/emplace", {100000}, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        registry.unique_index<NetworkId>(&NetworkId::value);
+        timer.start();
+        for (size_t i = 0; i < count; i++) {
+            registry.emplace<NetworkId>(registry.create(), static_cast<uint32_t>(i));
+        }
+        timer.stop();
+    });
+
+    return bench::run(suite, argc, argv);
+}
@@ -0,0 +1,101 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <random>
+
+using namespace wecs;
+
+struct Local {
+    float x, y, z;
+};
+
+struct World {
+    float x, y, z;
+};
+
+constexpr size_t depth = 12;
+
+// nodes spread evenly over the levels, each one attached below a random node of
+// the level above, in shuffled order
+std::vector<std::pair<entity, entity>> make_tree(registry& registry, size_t count) {
+    std::mt19937 engine{42};
+    std::vector<std::vector<entity>> levels(depth);
+    std::vector<std::pair<entity, entity>> edges;
+    for (size_t i = 0; i < count; i++) {
+        auto entity = registry.create();
+        registry.emplace<Local>(entity, 1.f, 2.f, 3.f);
+        registry.emplace<World>(entity);
+        auto level = i * depth / count;
+        if (level > 0) {
+            auto& above = levels[level - 1];
+            edges.emplace_back(entity, above[engine() % above.size()]);
+        }
+        levels[level].push_back(entity);
+    }
+    std::shuffle(edges.begin(), edges.end(), engine);
+    return edges;
+}
+
+void propagate(registry& registry, entity node, entity parent) {
+    auto& world = registry.storage<World>()[node];
+    const auto& local = registry.storage<Local>()[node];
+    const auto& origin = parent == empty_entity ? World{} : registry.storage<World>()[parent];
+    world = {origin.x + local.x, origin.y + local.y, origin.z + local.z};
+}
+
+void visit(registry& registry, hierarchy& hierarchy, entity node, entity parent) {
+    propagate(registry, node, parent);
+    hierarchy.each_child(node, [&](auto child) { visit(registry, hierarchy, child, node); });
+}
+
+int main(int argc, char** argv) {
+    const std::vector<size_t> counts{500000};
+    bench::Suite suite;
+
+    suite.add("hierarchy/attach", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        hierarchy hierarchy{registry};
+        auto edges = make_tree(registry, count);
+        timer.start();
+        for (auto [child, parent] : edges) {
+            hierarchy.attach(child, parent);
+        }
+        timer.stop();
+    });
+
+    // parents before children: one forward pass
+    suite.add("hierarchy/propagate/each", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        hierarchy hierarchy{registry};
+        for (auto [child, parent] : make_tree(registry, count)) {
+            hierarchy.attach(child, parent);
+        }
+        timer.start();
+        hierarchy.each([&registry](entity entity, relationship& node) {
+            propagate(registry, entity, node.parent);
+        });
+        timer.stop();
+    });
+
+    // the same links walked depth first from the roots
+    suite.add("hierarchy/propagate/recursive", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        hierarchy hierarchy{registry};
+        for (auto [child, parent] : make_tree(registry, count)) {
+            hierarchy.attach(child, parent);
+        }
+        std::vector<entity> roots;
+        hierarchy.each([&roots](entity entity, relationship& node) {
+            if (node.parent == empty_entity) {
+                roots.push_back(entity);
+            }
+        });
+        timer.start();
+        for (auto root : roots) {
+            visit(registry, hierarchy, root, empty_entity);
+        }
+        timer.stop();
+    });
+
+    return bench::run(suite, argc, argv);
+}
@@ -0,0 +1,79 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+#include <random>
+
+using namespace wecs;
+
+struct NextThink {
+    float time;
+};
+
+struct Brain {
+    int state;
+};
+
+constexpr size_t queries = 100;
+
+// think times spread over [0, 1000), every other entity with a brain
+void populate(registry& registry, size_t count) {
+    std::mt19937 engine{42};
+    std::uniform_real_distribution<float> time{0.f, 1000.f};
+    for (size_t i = 0; i < count; i++) {
+        auto entity = registry.create();
+        registry.emplace<NextThink>(entity, time(engine));
+        if (i % 2 == 0) {
+            registry.emplace<Brain>(entity, 0);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::vector<size_t> counts{10000, 100000};
+    bench::Suite suite;
+
+    // the brains due in a window of 1% of the times, joined straight from the tree
+    suite.add("ordered_index/range/index", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate(registry, count);
+        auto& index = registry.ordered_index<NextThink>(&NextThink::time);
+        timer.start();
+        for (size_t i = 0; i < queries; i++) {
+            const auto from = static_cast<float>(i) * 9.9f;
+            auto range = index.range(from, from + 10.f);
+            registry.each<Brain>(range.begin(), range.end(), [](entity, Brain& brain) { brain.state++; });
+        }
+        timer.stop();
+    });
+
+    // the same windows found by testing every entity
+    suite.add("ordered_index/range/scan", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate(registry, count);
+        timer.start();
+        for (size_t i = 0; i < queries; i++) {
+            const auto from = static_cast<float>(i) * 9.9f;
+            for (auto [holder, next, brain] : registry.view<NextThink, Brain>()) {
+                if (next.time >= from && next.time < from + 10.f) {
+                    brain.state++;
+                }
+            }
+        }
+        timer.stop();
+    });
+
+    // rescheduling, a patch moving each entry elsewhere in the tree
+    suite.add("ordered_index/replace", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate(registry, count);
+        registry.ordered_index<NextThink>(&NextThink::time);
+        std::mt19937 engine{3};
+        std::uniform_real_distribution<float> time{0.f, 1000.f};
+        timer.start();
+        for (auto value : registry.storage<NextThink>().packed()) {
+            registry.replace<NextThink>(static_cast<entity>(value), time(engine));
+        }
+        timer.stop();
+    });
+
+    return bench::run(suite, argc, argv);
+}
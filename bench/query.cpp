@@ -0,0 +1,64 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Frozen {};
+
+constexpr size_t systems = 200;
+
+// count entities placed, every other one moving and every eighth one frozen
+void populate(registry& registry, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        auto entity = registry.create();
+        registry.emplace<Position>(entity, 0.f, 0.f);
+        if (i % 2 == 0) {
+            registry.emplace<Velocity>(entity, 1.f, 1.f);
+        }
+        if (i % 8 == 0) {
+            registry.emplace<Frozen>(entity);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::vector<size_t> counts{16, 256, 4096};
+    bench::Suite suite;
+
+    // a frame of systems, each building its view anew
+    suite.add("query/frame/view", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate(registry, count);
+        timer.start();
+        for (size_t i = 0; i < systems; i++) {
+            registry.view<Position, const Velocity>(exclude<Frozen>).each([](entity, Position& position, const Velocity& velocity) {
+                position.x += velocity.x;
+            });
+        }
+        timer.stop();
+    });
+
+    // the same systems, each keeping the query it built once
+    suite.add("query/frame/query", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate(registry, count);
+        auto thawed = registry.query<Position, const Velocity>(exclude<Frozen>);
+        timer.start();
+        for (size_t i = 0; i < systems; i++) {
+            thawed.each([](entity, Position& position, const Velocity& velocity) {
+                position.x += velocity.x;
+            });
+        }
+        timer.stop();
+    });
+
+    return bench::run(suite, argc, argv);
+}
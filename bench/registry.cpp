@@ -0,0 +1,186 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <random>
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+// entities in shuffled order, half of them owning Velocity
+std::vector<entity> populate(registry& registry, size_t count) {
+    std::vector<entity> entities(count);
+    for (size_t i = 0; i < count; i++) {
+        entities[i] = registry.create();
+        registry.emplace<Position>(entities[i], 1.f, 2.f);
+        if (i % 2) {
+            registry.emplace<Velocity>(entities[i], 1.f, 2.f);
+        }
+    }
+    std::shuffle(entities.begin(), entities.end(), std::mt19937{42});
+    return entities;
+}
+
+int main(int argc, char** argv) {
+    const auto counts = bench::counts();
+    bench::Suite suite;
+
+    suite.add("registry/has/random", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto entities = populate(registry, count);
+        size_t found = 0;
+        timer.start();
+        for (auto entity : entities) {
+            found += registry.has<Velocity>(entity);
+        }
+        timer.stop();
+        bench::do_not_optimize(found);
+    });
+
+    suite.add("registry/get/random", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto entities = populate(registry, count);
+        float sum = 0.f;
+        timer.start();
+        for (auto entity : entities) {
+            sum += registry.get<Position>(entity).x;
+        }
+        timer.stop();
+        bench::do_not_optimize(sum);
+    });
+
+    // both components of those that have them, one at a time and as a tuple
+    suite.add("registry/get_each/random", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto entities = populate(registry, count);
+        auto moving = entities;
+        moving.erase(std::remove_if(moving.begin(), moving.end(), [&registry](auto entity) {
+            return !registry.has<Velocity>(entity);
+        }), moving.end());
+        float sum = 0.f;
+        timer.start();
+        for (auto entity : moving) {
+            sum += registry.get<Position>(entity).x * registry.get<Velocity>(entity).x;
+        }
+        timer.stop();
+        bench::do_not_optimize(sum);
+    });
+
+    suite.add("registry/get_tuple/random", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto entities = populate(registry, count);
+        auto moving = entities;
+        moving.erase(std::remove_if(moving.begin(), moving.end(), [&registry](auto entity) {
+            return !registry.has<Velocity>(entity);
+        }), moving.end());
+        float sum = 0.f;
+        timer.start();
+        for (auto entity : moving) {
+            auto [position, velocity] = registry.get<Position, Velocity>(entity);
+            sum += position.x * velocity.x;
+        }
+        timer.stop();
+        bench::do_not_optimize(sum);
+    });
+
+    // the velocity of those that have one: has then get, against a single try_get
+    suite.add("registry/has_get/random", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto entities = populate(registry, count);
+        float sum = 0.f;
+        timer.start();
+        for (auto entity : entities) {
+            if (registry.has<Velocity>(entity)) {
+                sum += registry.get<Velocity>(entity).x;
+            }
+        }
+        timer.stop();
+        bench::do_not_optimize(sum);
+    });
+
+    suite.add("registry/try_get/random", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto entities = populate(registry, count);
+        float sum = 0.f;
+        timer.start();
+        for (auto entity : entities) {
+            if (const auto* velocity = registry.try_get<Velocity>(entity)) {
+                sum += velocity->x;
+            }
+        }
+        timer.stop();
+        bench::do_not_optimize(sum);
+    });
+
+    // a tenth of the entities handed over to another registry
+    suite.add("registry/migrate/manual", counts, [](bench::Timer& timer, size_t count) {
+        registry source, target;
+        auto entities = populate(source, count);
+        entities.resize(count / 10u);
+        timer.start();
+        for (auto entity : entities) {
+            auto moved = target.create();
+            target.emplace<Position>(moved, source.get<Position>(entity));
+            if (source.has<Velocity>(entity)) {
+                target.emplace<Velocity>(moved, source.get<Velocity>(entity));
+            }
+            source.destroy(entity);
+        }
+        timer.stop();
+    });
+
+    suite.add("registry/migrate/move_to", counts, [](bench::Timer& timer, size_t count) {
+        registry source, target;
+        auto entities = populate(source, count);
+        entities.resize(count / 10u);
+        std::vector<entity> moved;
+        moved.reserve(entities.size());
+        timer.start();
+        source.move_to(target, entities.begin(), entities.end(), std::back_inserter(moved));
+        timer.stop();
+    });
+
+    // a copy of the whole registry, rebuilt entity by entity or cloned page by page
+    suite.add("registry/copy/manual", counts, [](bench::Timer& timer, size_t count) {
+        registry source;
+        populate(source, count);
+        timer.start();
+        registry copy;
+        for (auto [entity, position] : source.view<Position>()) {
+            auto created = copy.create();
+            copy.emplace<Position>(created, position);
+            if (source.has<Velocity>(entity)) {
+                copy.emplace<Velocity>(created, source.get<Velocity>(entity));
+            }
+        }
+        timer.stop();
+        bench::do_not_optimize(copy.size());
+    });
+
+    suite.add("registry/copy/clone", counts, [](bench::Timer& timer, size_t count) {
+        registry source;
+        populate(source, count);
+        timer.start();
+        auto copy = source.clone();
+        timer.stop();
+        bench::do_not_optimize(copy.size());
+    });
+
+    suite.add("registry/patch/random", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        auto entities = populate(registry, count);
+        timer.start();
+        for (auto entity : entities) {
+            registry.patch<Position>(entity, [](auto& pos) { pos.x += 1.f; });
+        }
+        timer.stop();
+    });
+
+    return bench::run(suite, argc, argv);
+}
@@ -0,0 +1,68 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+#include <cmath>
+
+using namespace wecs;
+
+template <size_t N>
+struct Component {
+    float value;
+};
+
+constexpr size_t component_count = 10;
+
+// system I reads one component and writes another, spread over component_count pools
+template <size_t I>
+void add_system(scheduler& scheduler) {
+    using read = Component<I % component_count>;
+    using write = Component<(I * 7 + 3) % component_count>;
+    if constexpr (std::is_same_v<read, write>) {
+        scheduler.add<Reads<>, Writes<write>>([](registry& registry) {
+            for (auto&& [entity, comp] : registry.view<write>()) {
+                comp.value = std::sqrt(comp.value * comp.value + 1.f);
+            }
+        });
+    } else {
+        scheduler.add<Reads<read>, Writes<write>>([](registry& registry) {
+            for (auto&& [entity, comp, other] : registry.view<write, read>()) {
+                comp.value = std::sqrt(comp.value * comp.value + other.value);
+            }
+        });
+    }
+}
+
+template <size_t... Index>
+void populate(registry& registry, size_t count, std::index_sequence<Index...>) {
+    for (size_t i = 0; i < count; i++) {
+        auto entity = registry.create();
+        (registry.emplace<Component<Index>>(entity, 1.f), ...);
+    }
+}
+
+template <size_t... Index>
+void add_systems(scheduler& scheduler, std::index_sequence<Index...>) {
+    (add_system<Index>(scheduler), ...);
+}
+
+void frame(bench::Timer& timer, size_t count, size_t threads) {
+    registry registry;
+    populate(registry, count, std::make_index_sequence<component_count>{});
+    scheduler scheduler{registry, threads};
+    add_systems(scheduler, std::make_index_sequence<50>{});
+    scheduler.run();
+    timer.start();
+    scheduler.run();
+    timer.stop();
+}
+
+int main(int argc, char** argv) {
+    const std::vector<size_t> counts{1'000, 10'000, 100'000};
+    bench::Suite suite;
+    suite.add("scheduler/50_systems/1_thread", counts, [](bench::Timer& timer, size_t count) {
+        frame(timer, count, 1);
+    });
+    suite.add("scheduler/50_systems/all_threads", counts, [](bench::Timer& timer, size_t count) {
+        frame(timer, count, std::thread::hardware_concurrency());
+    });
+    return bench::run(suite, argc, argv);
+}
@@ -0,0 +1,59 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+
+using namespace wecs;
+
+struct Event {
+    int value;
+};
+
+struct Listener {
+    void receive(const Event& event) {
+        sum += event.value;
+    }
+
+    int sum = 0;
+};
+
+int main(int argc, char** argv) {
+    const auto counts = bench::counts();
+    bench::Suite suite;
+
+    suite.add("signal/trigger/4", counts, [](bench::Timer& timer, size_t count) {
+        Sigh<void(const Event&)> sigh;
+        Listener listeners[4];
+        for (auto& listener : listeners) {
+            Sink{sigh}.connect<&Listener::receive>(listener);
+        }
+        timer.start();
+        for (size_t i = 0; i < count; i++) {
+            sigh.trigger(Event{static_cast<int>(i)});
+        }
+        timer.stop();
+        bench::do_not_optimize(listeners);
+    });
+
+    suite.add("dispatcher/enqueue", counts, [](bench::Timer& timer, size_t count) {
+        dispatcher dispatcher;
+        timer.start();
+        for (size_t i = 0; i < count; i++) {
+            dispatcher.enqueue<Event>(static_cast<int>(i));
+        }
+        timer.stop();
+    });
+
+    suite.add("dispatcher/update", counts, [](bench::Timer& timer, size_t count) {
+        dispatcher dispatcher;
+        Listener listener;
+        dispatcher.sink<Event>().connect<&Listener::receive>(listener);
+        for (size_t i = 0; i < count; i++) {
+            dispatcher.enqueue<Event>(static_cast<int>(i));
+        }
+        timer.start();
+        dispatcher.update();
+        timer.stop();
+        bench::do_not_optimize(listener);
+    });
+
+    return bench::run(suite, argc, argv);
+}
@@ -0,0 +1,89 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+#include <random>
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+constexpr float extent = 1000.f;
+constexpr float radius = 10.f;
+constexpr size_t queries = 100;
+
+void populate(registry& registry, size_t count) {
+    std::mt19937 engine{42};
+    std::uniform_real_distribution<float> coord{0.f, extent};
+    for (size_t i = 0; i < count; i++) {
+        registry.emplace<Position>(registry.create(), coord(engine), coord(engine));
+    }
+}
+
+std::vector<std::pair<float, float>> centers() {
+    std::mt19937 engine{7};
+    std::uniform_real_distribution<float> coord{0.f, extent};
+    std::vector<std::pair<float, float>> result;
+    for (size_t i = 0; i < queries; i++) {
+        result.emplace_back(coord(engine), coord(engine));
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    const std::vector<size_t> counts{10000, 100000};
+    bench::Suite suite;
+
+    // radius queries answered from the grid
+    suite.add("spatial_hash/query/hash", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate(registry, count);
+        spatial_hash<&Position::x, &Position::y> index{registry, radius};
+        std::vector<entity> found;
+        timer.start();
+        for (auto [x, y] : centers()) {
+            found.clear();
+            index.query(x, y, radius, found);
+            bench::do_not_optimize(found);
+        }
+        timer.stop();
+    });
+
+    // the same queries testing every position
+    suite.add("spatial_hash/query/scan", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate(registry, count);
+        std::vector<entity> found;
+        timer.start();
+        for (auto [x, y] : centers()) {
+            found.clear();
+            for (auto [entity, position] : registry.view<Position>()) {
+                const auto dx = position.x - x;
+                const auto dy = position.y - y;
+                if (dx * dx + dy * dy <= radius * radius) {
+                    found.push_back(entity);
+                }
+            }
+            bench::do_not_optimize(found);
+        }
+        timer.stop();
+    });
+
+    // cost of keeping the grid current while positions change
+    suite.add("spatial_hash/replace", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate(registry, count);
+        spatial_hash<&Position::x, &Position::y> index{registry, radius};
+        std::mt19937 engine{3};
+        std::uniform_real_distribution<float> step{-2.f, 2.f};
+        timer.start();
+        for (auto value : registry.storage<Position>().packed()) {
+            const auto moved = static_cast<entity>(value);
+            const auto position = registry.get<Position>(moved);
+            registry.replace<Position>(moved, position.x + step(engine), position.y + step(engine));
+        }
+        timer.stop();
+    });
+
+    return bench::run(suite, argc, argv);
+}
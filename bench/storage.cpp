@@ -0,0 +1,162 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <random>
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    static constexpr bool signal = false;
+
+    float x, y;
+};
+
+struct Particle {
+    float x, y, z, vx, vy, vz;
+};
+
+struct SoaParticle : Particle {
+    static constexpr auto fields = std::make_tuple(&SoaParticle::x, &SoaParticle::y, &SoaParticle::z,
+                                                   &SoaParticle::vx, &SoaParticle::vy, &SoaParticle::vz);
+};
+
+struct Transform {
+    float m[16];
+};
+
+struct CacheLineTransform : Transform {
+    static constexpr size_t page_alignment = config::cache_line_size;
+};
+
+// each page fills one 2 MiB huge page
+struct HugePageTransform : Transform {
+    static constexpr size_t page_alignment = config::huge_page_size;
+    static constexpr size_t page_size = config::huge_page_size / sizeof(Transform);
+};
+
+using Storage = BasicStorage<entity, Position, config::page_size, std::allocator<Position>>;
+using Mixin = SighMixin<Storage>;
+
+void listener(entity, Position&) {}
+
+template <typename Pool>
+void emplace(bench::Timer& timer, size_t count) {
+    Pool pool;
+    timer.start();
+    for (size_t i = 0; i < count; i++) {
+        pool.emplace(static_cast<entity>(i), 1.f, 2.f);
+    }
+    timer.stop();
+}
+
+template <typename Pool>
+void remove(bench::Timer& timer, size_t count) {
+    Pool pool;
+    for (size_t i = 0; i < count; i++) {
+        pool.emplace(static_cast<entity>(i), 1.f, 2.f);
+    }
+    timer.start();
+    for (size_t i = 0; i < count; i++) {
+        pool.remove(static_cast<entity>(i));
+    }
+    timer.stop();
+}
+
+template <typename Type>
+void registry_emplace_remove(bench::Timer& timer, size_t count) {
+    registry registry;
+    std::vector<entity> entities(count);
+    for (auto& entity : entities) {
+        entity = registry.create();
+    }
+    timer.start();
+    for (auto entity : entities) {
+        registry.emplace<Type>(entity, 1.f, 2.f);
+    }
+    for (auto entity : entities) {
+        registry.remove<Type>(entity);
+    }
+    timer.stop();
+}
+
+// integrate the position of every particle, element by element or field array by field array
+void update_aos(bench::Timer& timer, size_t count) {
+    BasicStorage<entity, Particle, config::page_size, std::allocator<Particle>> pool;
+    for (size_t i = 0; i < count; i++) {
+        pool.emplace(static_cast<entity>(i), Particle{0.f, 0.f, 0.f, 1.f, 2.f, 3.f});
+    }
+    timer.start();
+    for (auto& particle : pool) {
+        particle.x += particle.vx;
+        particle.y += particle.vy;
+        particle.z += particle.vz;
+    }
+    timer.stop();
+}
+
+void update_soa(bench::Timer& timer, size_t count) {
+    BasicSoaStorage<entity, SoaParticle, config::page_size> pool;
+    for (size_t i = 0; i < count; i++) {
+        pool.emplace(static_cast<entity>(i), Particle{0.f, 0.f, 0.f, 1.f, 2.f, 3.f});
+    }
+    timer.start();
+    pool.each([](size_t size, float* x, float* y, float* z, float* vx, float* vy, float* vz) {
+        for (size_t i = 0; i < size; i++) {
+            x[i] += vx[i];
+            y[i] += vy[i];
+            z[i] += vz[i];
+        }
+    });
+    timer.stop();
+}
+
+// read components in shuffled order, dominated by cache and TLB misses on large pools
+template <typename Type>
+void random_access(bench::Timer& timer, size_t count) {
+    registry::storage_for_t<Type> pool;
+    std::vector<entity> entities(count);
+    for (size_t i = 0; i < count; i++) {
+        entities[i] = static_cast<entity>(i);
+        pool.emplace(entities[i]);
+    }
+    std::shuffle(entities.begin(), entities.end(), std::mt19937{42});
+    float sum = 0.f;
+    timer.start();
+    for (auto entity : entities) {
+        sum += pool[entity].m[0];
+    }
+    timer.stop();
+    bench::do_not_optimize(sum);
+}
+
+int main(int argc, char** argv) {
+    const auto counts = bench::counts();
+    bench::Suite suite;
+
+    suite.add("storage/emplace", counts, emplace<Storage>);
+    suite.add("storage/emplace/mixin", counts, emplace<Mixin>);
+    suite.add("storage/emplace/mixin/listener", counts, [](bench::Timer& timer, size_t count) {
+        Mixin pool;
+        pool.on_construct().connect<&listener>();
+        timer.start();
+        for (size_t i = 0; i < count; i++) {
+            pool.emplace(static_cast<entity>(i), 1.f, 2.f);
+        }
+        timer.stop();
+    });
+    suite.add("storage/remove", counts, remove<Storage>);
+    suite.add("storage/remove/mixin", counts, remove<Mixin>);
+    suite.add("registry/emplace_remove/signal", counts, registry_emplace_remove<Position>);
+    suite.add("registry/emplace_remove/no_signal", counts, registry_emplace_remove<Velocity>);
+    suite.add("storage/update/aos", counts, update_aos);
+    suite.add("storage/update/soa", counts, update_soa);
+    suite.add("storage/random_access/default", counts, random_access<Transform>);
+    suite.add("storage/random_access/cache_line", counts, random_access<CacheLineTransform>);
+    suite.add("storage/random_access/huge_page", counts, random_access<HugePageTransform>);
+
+    return bench::run(suite, argc, argv);
+}
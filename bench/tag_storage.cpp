@@ -0,0 +1,87 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+// empty, so held in a bitset
+struct Stunned {};
+struct Visible {};
+
+// the same flags with a byte of payload, held in sparse sets
+struct StunnedFlag {
+    char unused;
+};
+struct VisibleFlag {
+    char unused;
+};
+
+// every entity placed, half of them visible, a third of them stunned
+template <typename StunnedType, typename VisibleType>
+void populate(registry& registry, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        auto entity = registry.create();
+        registry.emplace<Position>(entity, static_cast<float>(i), 0.f);
+        if (i % 2 == 0) {
+            registry.emplace<VisibleType>(entity);
+        }
+        if (i % 3 == 0) {
+            registry.emplace<StunnedType>(entity);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::vector<size_t> counts{10000, 100000};
+    bench::Suite suite;
+
+    suite.add("tag_storage/exclude/bitset", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate<Stunned, Visible>(registry, count);
+        timer.start();
+        for (auto [entity, position] : registry.view<Position>(exclude<Stunned>)) {
+            position.x += 1.f;
+        }
+        timer.stop();
+    });
+
+    suite.add("tag_storage/exclude/sparse", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate<StunnedFlag, VisibleFlag>(registry, count);
+        timer.start();
+        for (auto [entity, position] : registry.view<Position>(exclude<StunnedFlag>)) {
+            position.x += 1.f;
+        }
+        timer.stop();
+    });
+
+    // tags alone, filtered a word of 64 entities at a time
+    suite.add("tag_storage/tags/bitset", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate<Stunned, Visible>(registry, count);
+        size_t found = 0;
+        timer.start();
+        for (auto [entity, visible] : registry.view<Visible>(exclude<Stunned>)) {
+            found++;
+        }
+        timer.stop();
+        bench::do_not_optimize(found);
+    });
+
+    suite.add("tag_storage/tags/sparse", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate<StunnedFlag, VisibleFlag>(registry, count);
+        size_t found = 0;
+        timer.start();
+        for (auto [entity, visible] : registry.view<VisibleFlag>(exclude<StunnedFlag>)) {
+            found++;
+        }
+        timer.stop();
+        bench::do_not_optimize(found);
+    });
+
+    return bench::run(suite, argc, argv);
+}
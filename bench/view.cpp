@@ -0,0 +1,113 @@
+#include "wecs/wecs.hpp"
+#include "bench/bench.hpp"
+#include <algorithm>
+#include <random>
+
+using namespace wecs;
+
+template <size_t N>
+struct Component {
+    int value;
+};
+
+// every entity owns Component<0>, the others are owned with probability selectivity
+template <size_t... Index>
+void intersect(bench::Timer& timer, size_t count, double selectivity, std::index_sequence<Index...>) {
+    registry registry;
+    std::mt19937 engine{42};
+    std::bernoulli_distribution owned{selectivity};
+    for (size_t i = 0; i < count; i++) {
+        auto entity = registry.create();
+        registry.emplace<Component<0>>(entity, 0);
+        ((owned(engine) ? (void)registry.emplace<Component<Index + 1>>(entity, 0) : void()), ...);
+    }
+    timer.start();
+    auto view = registry.view<Component<0>, Component<Index + 1>...>();
+    timer.stop();
+    bench::do_not_optimize(view);
+}
+
+template <size_t Pools>
+void add_intersect(bench::Suite& suite, const std::vector<size_t>& counts) {
+    for (auto selectivity : {0.1, 0.5, 0.9}) {
+        auto name = "view/intersect/" + std::to_string(Pools) + "/" + std::to_string(static_cast<int>(selectivity * 100)) + "%";
+        suite.add(name, counts, [selectivity](bench::Timer& timer, size_t count) {
+            intersect(timer, count, selectivity, std::make_index_sequence<Pools - 1>{});
+        });
+    }
+}
+
+// iterate a view whose entities own every component
+template <size_t... Index>
+void iterate(bench::Timer& timer, size_t count, std::index_sequence<Index...>) {
+    registry registry;
+    for (size_t i = 0; i < count; i++) {
+        auto entity = registry.create();
+        (registry.emplace<Component<Index>>(entity, 1), ...);
+    }
+    auto view = registry.view<Component<Index>...>();
+    timer.start();
+    for (auto&& tuple : view) {
+        std::apply([](auto, auto&... comp) { ((comp.value += 1), ...); }, tuple);
+    }
+    timer.stop();
+}
+
+template <size_t Pools>
+void add_iterate(bench::Suite& suite, const std::vector<size_t>& counts) {
+    suite.add("view/iterate/" + std::to_string(Pools), counts, [](bench::Timer& timer, size_t count) {
+        iterate(timer, count, std::make_index_sequence<Pools>{});
+    });
+}
+
+// every pool holds all entities, each in its own shuffled packed order
+template <size_t... Index>
+void populate_shuffled(registry& registry, size_t count, std::index_sequence<Index...>) {
+    std::vector<entity> entities(count);
+    for (auto& entity : entities) {
+        entity = registry.create();
+        registry.emplace<Component<0>>(entity, 1);
+    }
+    std::mt19937 engine{42};
+    ((std::shuffle(entities.begin(), entities.end(), engine),
+      std::for_each(entities.begin(), entities.end(), [&registry](auto entity) {
+          registry.emplace<Component<Index + 1>>(entity, 1);
+      })), ...);
+}
+
+// three pools, secondary lookups jumping around memory
+void add_random(bench::Suite& suite, const std::vector<size_t>& counts) {
+    suite.add("view/random/3/iterate", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate_shuffled(registry, count, std::make_index_sequence<2>{});
+        auto view = registry.view<Component<0>, Component<1>, Component<2>>();
+        timer.start();
+        for (auto [entity, comp0, comp1, comp2] : view) {
+            comp0.value += comp1.value + comp2.value;
+        }
+        timer.stop();
+    });
+    suite.add("view/random/3/each", counts, [](bench::Timer& timer, size_t count) {
+        registry registry;
+        populate_shuffled(registry, count, std::make_index_sequence<2>{});
+        auto view = registry.view<Component<0>, Component<1>, Component<2>>();
+        timer.start();
+        view.each([](entity, auto& comp0, auto& comp1, auto& comp2) {
+            comp0.value += comp1.value + comp2.value;
+        });
+        timer.stop();
+    });
+}
+
+int main(int argc, char** argv) {
+    const auto counts = bench::counts();
+    bench::Suite suite;
+    add_intersect<2>(suite, counts);
+    add_intersect<3>(suite, counts);
+    add_intersect<4>(suite, counts);
+    add_iterate<1>(suite, counts);
+    add_iterate<2>(suite, counts);
+    add_iterate<3>(suite, counts);
+    add_random(suite, counts);
+    return bench::run(suite, argc, argv);
+}
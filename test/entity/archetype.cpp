@@ -0,0 +1,121 @@
+#include "wecs/wecs.hpp"
+#include "wecs/entity/archetype.hpp"
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Name {
+    std::string str;
+};
+
+TEST_CASE("archetype registry") {
+    archetype_registry registry;
+
+    SECTION("migration") {
+        auto entity_1 = registry.create();
+        auto entity_2 = registry.create();
+        REQUIRE(registry.size() == 2);
+        REQUIRE_FALSE(registry.has<Position>(entity_1));
+
+        registry.emplace<Position>(entity_1, 1.0f, 2.0f);
+        registry.emplace<Name>(entity_1, "entity_1");
+        registry.emplace<Position>(entity_2, 3.0f, 4.0f);
+        REQUIRE(registry.has<Position>(entity_1));
+        REQUIRE(registry.has<Name>(entity_1));
+        REQUIRE_FALSE(registry.has<Name>(entity_2));
+        REQUIRE(registry.get<Position>(entity_1).y == 2.0f);
+        REQUIRE(registry.get<Name>(entity_1).str == "entity_1");
+
+        // {}, {Position}, {Position, Name}, shared whatever the order components came in
+        auto entity_3 = registry.create();
+        registry.emplace<Name>(entity_3, "entity_3");
+        registry.emplace<Position>(entity_3, 5.0f, 6.0f);
+        REQUIRE(registry.archetypes().size() == 4);
+        REQUIRE(registry.archetypes()[2]->size() == 2);
+
+        registry.remove<Position>(entity_1);
+        REQUIRE_FALSE(registry.has<Position>(entity_1));
+        REQUIRE(registry.get<Name>(entity_1).str == "entity_1");
+        REQUIRE(registry.get<Name>(entity_3).str == "entity_3");
+        REQUIRE(registry.get<Position>(entity_3).x == 5.0f);
+        REQUIRE(registry.get<Position>(entity_2).x == 3.0f);
+
+        registry.destroy(entity_2);
+        REQUIRE_FALSE(registry.alive(entity_2));
+        REQUIRE_FALSE(registry.has<Position>(entity_2));
+        REQUIRE(registry.get<Position>(entity_3).y == 6.0f);
+        REQUIRE(registry.size() == 2);
+
+        registry.clear();
+        REQUIRE(registry.size() == 0);
+        REQUIRE_FALSE(registry.alive(entity_1));
+    }
+
+    SECTION("view") {
+        for (int i = 0; i < 1000; i++) {
+            auto entity = registry.create();
+            registry.emplace<Position>(entity, static_cast<float>(i), 0.0f);
+            if (i % 2 == 0) {
+                registry.emplace<Velocity>(entity, 1.0f, 1.0f);
+            }
+            if (i % 4 == 0) {
+                registry.emplace<Name>(entity, std::to_string(i));
+            }
+        }
+
+        auto view = registry.view<Position, Velocity>();
+        REQUIRE(view.size() == 500);
+        REQUIRE(view.archetypes().size() == 2);
+        view.each([](entity, Position& position, Velocity& velocity) {
+            position.x += velocity.x;
+            position.y += velocity.y;
+        });
+
+        size_t chunks = 0;
+        float sum = 0;
+        registry.view<Position>().each_chunk([&](size_t size, entity*, Position* positions) {
+            REQUIRE(size > 0);
+            chunks++;
+            for (size_t i = 0; i < size; i++) {
+                sum += positions[i].y;
+            }
+        });
+        REQUIRE(sum == 500.0f);
+        REQUIRE(chunks == 3);
+
+        registry.view<Name>().each([&registry](entity entity, Name& name) {
+            REQUIRE(registry.get<Position>(entity).x == std::stof(name.str) + 1.0f);
+        });
+    }
+
+    SECTION("chunks") {
+        std::vector<entity> entities;
+        for (int i = 0; i < 4000; i++) {
+            entities.push_back(registry.create());
+            registry.emplace<Position>(entities.back(), static_cast<float>(i), 0.0f);
+        }
+        auto& archetype = *registry.archetypes()[1];
+        REQUIRE(archetype.chunks() > 1);
+        REQUIRE(archetype.reserved() == archetype.chunks() * config::chunk_size);
+
+        for (int i = 0; i < 4000; i += 3) {
+            registry.remove<Position>(entities[i]);
+        }
+        for (int i = 0; i < 4000; i++) {
+            REQUIRE(registry.has<Position>(entities[i]) == (i % 3 != 0));
+            if (i % 3 != 0) {
+                REQUIRE(registry.get<Position>(entities[i]).x == static_cast<float>(i));
+            }
+        }
+    }
+}
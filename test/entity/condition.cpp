@@ -0,0 +1,94 @@
+#include "wecs/wecs.hpp"
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Player {
+    int id;
+};
+
+struct Enemy {
+    int id;
+};
+
+struct Frozen {};
+
+TEST_CASE("presence checks") {
+    registry registry;
+    auto moving = registry.create();
+    auto frozen = registry.create();
+    auto bare = registry.create();
+    registry.emplace<Position>(moving, 0.f, 0.f);
+    registry.emplace<Velocity>(moving, 1.f, 0.f);
+    registry.emplace<Position>(frozen, 0.f, 0.f);
+    registry.emplace<Frozen>(frozen);
+
+    REQUIRE(registry.all_of<Position, Velocity>(moving));
+    REQUIRE_FALSE(registry.all_of<Position, Velocity>(frozen));
+    REQUIRE(registry.all_of<Position, Frozen>(frozen));
+    REQUIRE(registry.all_of<>(bare));
+
+    REQUIRE(registry.any_of<Velocity, Frozen>(moving));
+    REQUIRE(registry.any_of<Velocity, Frozen>(frozen));
+    REQUIRE_FALSE(registry.any_of<Velocity, Frozen>(bare));
+    // a type without a pool yet
+    REQUIRE_FALSE(registry.any_of<Player>(moving));
+
+    REQUIRE(registry.none_of<Frozen, Player>(moving));
+    REQUIRE_FALSE(registry.none_of<Frozen, Player>(frozen));
+
+    // stale handles have nothing, tags included
+    registry.destroy(frozen);
+    auto recycled = registry.create();
+    registry.emplace<Frozen>(recycled);
+    if (recycled != frozen) {
+        REQUIRE_FALSE(registry.any_of<Position, Frozen>(frozen));
+        REQUIRE(registry.none_of<Frozen>(frozen));
+    }
+}
+
+TEST_CASE("condition") {
+    registry registry;
+    auto condition = registry.condition();
+    condition.all_of<Position>().any_of<Player, Enemy>().none_of<Frozen>();
+
+    auto player = registry.create();
+    registry.emplace<Position>(player, 0.f, 0.f);
+    registry.emplace<Player>(player, 1);
+    auto enemy = registry.create();
+    registry.emplace<Position>(enemy, 0.f, 0.f);
+    registry.emplace<Enemy>(enemy, 2);
+    auto frozen = registry.create();
+    registry.emplace<Position>(frozen, 0.f, 0.f);
+    registry.emplace<Enemy>(frozen, 3);
+    registry.emplace<Frozen>(frozen);
+    auto nobody = registry.create();
+    registry.emplace<Position>(nobody, 0.f, 0.f);
+
+    REQUIRE(condition(player));
+    REQUIRE(condition(enemy));
+    REQUIRE_FALSE(condition(frozen));
+    REQUIRE_FALSE(condition(nobody));
+
+    // pools resolved when the condition was built keep seeing later changes
+    registry.remove<Frozen>(frozen);
+    REQUIRE(condition(frozen));
+    registry.remove<Position>(player);
+    REQUIRE_FALSE(condition(player));
+
+    registry.destroy(enemy);
+    REQUIRE_FALSE(condition(enemy));
+
+    auto empty = registry.condition();
+    REQUIRE(empty(nobody));
+}
@@ -0,0 +1,84 @@
+#include "wecs/wecs.hpp"
+#include "wecs/entity/entity_pool.hpp"
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+#define Entity(x) static_cast<entity>(x)
+
+struct Point {
+    float x, y;
+};
+
+void count_destroyed(size_t& count, entity) {
+    count++;
+}
+
+TEST_CASE("entity pool") {
+    BasicEntityPool<entity> pool;
+    REQUIRE(pool.empty());
+    REQUIRE(pool.begin() == pool.end());
+
+    auto entity_0 = pool.emplace();
+    auto entity_1 = pool.emplace();
+    auto entity_2 = pool.emplace();
+    REQUIRE(entity_0 == Entity(0));
+    REQUIRE(entity_1 == Entity(1));
+    REQUIRE(entity_2 == Entity(2));
+    REQUIRE(pool.size() == 3);
+
+    pool.remove(entity_1);
+    pool.remove(entity_0);
+    REQUIRE(pool.size() == 1);
+    REQUIRE(pool.base_size() == 3);
+    REQUIRE_FALSE(pool.contain(entity_0));
+    REQUIRE_FALSE(pool.contain(entity_1));
+    REQUIRE(pool.contain(entity_2));
+
+    std::vector<entity> alive(pool.begin(), pool.end());
+    REQUIRE(alive == std::vector<entity>{entity_2});
+
+    // last destroyed, first recycled
+    auto entity_3 = pool.emplace();
+    REQUIRE(to_integral(entity_3) == 0x00100000);
+    auto entity_4 = pool.emplace();
+    REQUIRE(to_integral(entity_4) == 0x00100001);
+    auto entity_5 = pool.emplace();
+    REQUIRE(entity_5 == Entity(3));
+    REQUIRE(pool.contain(entity_3));
+    REQUIRE_FALSE(pool.contain(entity_0));
+
+    size_t count = 0;
+    pool.each([&](auto entity) {
+        REQUIRE(pool.contain(entity));
+        count++;
+    });
+    REQUIRE(count == 4);
+
+    pool.clear();
+    REQUIRE(pool.empty());
+    REQUIRE(pool.emplace() == Entity(0));
+}
+
+TEST_CASE("registry with entity pool") {
+    BasicRegistry<entity, config::page_size, SighMixin<BasicEntityPool<entity>>> registry;
+    size_t destroyed = 0;
+    registry.on_destruction<entity>().connect<&count_destroyed>(destroyed);
+
+    auto entity_0 = registry.create();
+    auto entity_1 = registry.create();
+    registry.emplace<Point>(entity_0, Point{1.0f, 2.0f});
+    registry.emplace<Point>(entity_1, Point{3.0f, 4.0f});
+    registry.destroy(entity_0);
+    REQUIRE(destroyed == 1);
+    REQUIRE_FALSE(registry.alive(entity_0));
+    REQUIRE(registry.size() == 1);
+
+    auto entity_2 = registry.create();
+    REQUIRE(to_entity(entity_2) == to_entity(entity_0));
+    REQUIRE_FALSE(registry.has<Point>(entity_2));
+    registry.emplace<Point>(entity_2, Point{5.0f, 6.0f});
+    REQUIRE(registry.view<Point>().size() == 2);
+}
@@ -0,0 +1,122 @@
+#include "wecs/wecs.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+struct NetworkId {
+    uint32_t value;
+};
+
+struct Name {
+    std::string value;
+};
+
+std::vector<entity> holding(registry::hash_index_type<Name, std::string>& index, const std::string& key) {
+    std::vector<entity> result;
+    index.each(key, [&result](entity holder) { result.push_back(holder); });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST_CASE("hash index") {
+    registry registry;
+
+    SECTION("unique") {
+        auto first = registry.create();
+        registry.emplace<NetworkId>(first, 7u);
+
+        auto& index = registry.unique_index<NetworkId>(&NetworkId::value);
+        REQUIRE(&index == &registry.unique_index<NetworkId>(&NetworkId::value));
+        REQUIRE(index.size() == 1);
+        REQUIRE(index.find(7u) == first);
+
+        auto second = registry.create();
+        registry.emplace<NetworkId>(second, 8u);
+        REQUIRE(index.find(8u) == second);
+        REQUIRE((index.find(9u) == empty_entity));
+
+        registry.replace<NetworkId>(second, 9u);
+        REQUIRE((index.find(8u) == empty_entity));
+        REQUIRE(index.find(9u) == second);
+
+        registry.patch<NetworkId>(first, [](auto& id) { id.value = 10u; });
+        REQUIRE(index.find(10u) == first);
+        REQUIRE_FALSE(index.contain(7u));
+
+        registry.destroy(first);
+        REQUIRE(index.size() == 1);
+        REQUIRE_FALSE(index.contain(10u));
+
+        registry.get_mutable<NetworkId>(second).value = 11u;
+        index.refresh(second);
+        REQUIRE(index.find(11u) == second);
+
+        registry.clear();
+        REQUIRE(index.size() == 0);
+        REQUIRE_FALSE(index.contain(11u));
+    }
+
+    SECTION("multi") {
+        auto& index = registry.index<Name>(&Name::value);
+        auto boss = registry.create();
+        auto minion_1 = registry.create();
+        auto minion_2 = registry.create();
+        registry.emplace<Name>(boss, "boss");
+        registry.emplace<Name>(minion_1, "minion");
+        registry.emplace<Name>(minion_2, "minion");
+
+        REQUIRE(index.find("boss") == boss);
+        REQUIRE(index.count("minion") == 2);
+        REQUIRE(holding(index, "minion") == std::vector<entity>{minion_1, minion_2});
+
+        registry.replace<Name>(minion_1, "boss");
+        REQUIRE(holding(index, "boss") == std::vector<entity>{boss, minion_1});
+        REQUIRE(holding(index, "minion") == std::vector<entity>{minion_2});
+
+        registry.remove<Name>(boss);
+        REQUIRE(holding(index, "boss") == std::vector<entity>{minion_1});
+    }
+
+    SECTION("random") {
+        // few distinct keys, so clusters overlap and removals shift entries back
+        auto& index = registry.index<NetworkId>(&NetworkId::value);
+        std::mt19937 engine{11};
+        std::vector<entity> entities;
+        for (size_t i = 0; i < 5000; i++) {
+            auto created = registry.create();
+            registry.emplace<NetworkId>(created, static_cast<uint32_t>(engine() % 300u));
+            entities.push_back(created);
+        }
+        for (size_t i = 0; i < 20000; i++) {
+            auto target = entities[engine() % entities.size()];
+            if (!registry.alive(target)) {
+                continue;
+            }
+            switch (engine() % 3u) {
+            case 0:
+                registry.replace<NetworkId>(target, static_cast<uint32_t>(engine() % 300u));
+                break;
+            case 1:
+                registry.destroy(target);
+                break;
+            default:
+                registry.emplace<NetworkId>(registry.create(), static_cast<uint32_t>(engine() % 300u));
+            }
+        }
+
+        REQUIRE(index.size() == registry.storage<NetworkId>().size());
+        for (uint32_t key = 0; key < 300u; key++) {
+            size_t expected = 0;
+            for (auto [holder, id] : registry.view<NetworkId>()) {
+                expected += id.value == key;
+            }
+            REQUIRE(index.count(key) == expected);
+            index.each(key, [&](entity holder) { REQUIRE(registry.get<NetworkId>(holder).value == key); });
+        }
+    }
+}
@@ -0,0 +1,96 @@
+#include "wecs/wecs.hpp"
+#include "wecs/entity/hierarchy.hpp"
+#include <random>
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+// every parent is packed before its children
+bool ordered(registry& registry, hierarchy& hierarchy) {
+    auto& pool = registry.storage<relationship>();
+    bool result = true;
+    hierarchy.each([&](entity entity, relationship& node) {
+        if (node.parent != empty_entity && pool.index(node.parent) > pool.index(entity)) {
+            result = false;
+        }
+    });
+    return result;
+}
+
+std::vector<entity> children(hierarchy& hierarchy, entity parent) {
+    std::vector<entity> result;
+    hierarchy.each_child(parent, [&result](entity child) { result.push_back(child); });
+    return result;
+}
+
+TEST_CASE("hierarchy") {
+    registry registry;
+    hierarchy hierarchy{registry};
+
+    SECTION("links") {
+        auto root = registry.create();
+        auto child_1 = registry.create();
+        auto child_2 = registry.create();
+        auto grandchild = registry.create();
+
+        hierarchy.attach(grandchild, child_1);
+        hierarchy.attach(child_1, root);
+        hierarchy.attach(child_2, root);
+        REQUIRE(hierarchy.size() == 4);
+        REQUIRE(hierarchy.parent(child_1) == root);
+        REQUIRE((hierarchy.parent(root) == empty_entity));
+        REQUIRE(children(hierarchy, root) == std::vector<entity>{child_2, child_1});
+        REQUIRE(hierarchy.is_ancestor(root, grandchild));
+        REQUIRE_FALSE(hierarchy.is_ancestor(child_2, grandchild));
+        REQUIRE(ordered(registry, hierarchy));
+
+        // reparenting moves the whole subtree
+        hierarchy.attach(child_1, child_2);
+        REQUIRE(children(hierarchy, root) == std::vector<entity>{child_2});
+        REQUIRE(children(hierarchy, child_2) == std::vector<entity>{child_1});
+        REQUIRE(hierarchy.is_ancestor(child_2, grandchild));
+        REQUIRE(ordered(registry, hierarchy));
+
+        hierarchy.detach(child_2);
+        REQUIRE((hierarchy.parent(child_2) == empty_entity));
+        REQUIRE(children(hierarchy, root).empty());
+        REQUIRE(children(hierarchy, child_2) == std::vector<entity>{child_1});
+
+        // children of a destroyed entity become roots
+        registry.destroy(child_1);
+        REQUIRE(hierarchy.size() == 3);
+        REQUIRE((hierarchy.parent(grandchild) == empty_entity));
+        REQUIRE(children(hierarchy, child_2).empty());
+        REQUIRE(ordered(registry, hierarchy));
+    }
+
+    SECTION("random") {
+        std::mt19937 engine{7};
+        std::vector<entity> entities;
+        for (int i = 0; i < 500; i++) {
+            entities.push_back(registry.create());
+        }
+        for (int round = 0; round < 2000; round++) {
+            auto child = entities[engine() % entities.size()];
+            auto parent = entities[engine() % entities.size()];
+            if (!hierarchy.is_ancestor(child, parent)) {
+                hierarchy.attach(child, parent);
+            }
+            if (round % 100 == 0) {
+                auto pos = engine() % entities.size();
+                registry.destroy(entities[pos]);
+                entities[pos] = registry.create();
+            }
+        }
+        REQUIRE(ordered(registry, hierarchy));
+
+        // a single forward pass sees every parent before its children
+        std::unordered_map<entity, int> depth;
+        hierarchy.each([&depth](entity entity, relationship& node) {
+            depth[entity] = node.parent == empty_entity ? 0 : depth.at(node.parent) + 1;
+        });
+        REQUIRE(depth.size() == hierarchy.size());
+    }
+}
@@ -16,6 +16,12 @@ void construct() {
     std::cout << "construct\n";
 }
 
+int destruction_count = 0;
+
+void destruction(entity, Point&) {
+    destruction_count++;
+}
+
 TEST_CASE("mixin") {
     using Storage = BasicStorage<entity, Point, config::page_size, std::allocator<Point>>;
     SighMixin<Storage> mixin;
@@ -24,4 +30,12 @@ TEST_CASE("mixin") {
     auto& p1 = mixin.emplace(Entity(0), 1.0f, 3.0f);
     REQUIRE(p1.x == 1.0f);
     REQUIRE(p1.y == 3.0f);
+
+    mixin.remove(Entity(0));
+    REQUIRE(destruction_count == 0);
+
+    mixin.on_destruction().connect<&destruction>();
+    mixin.emplace(Entity(1), 2.0f, 4.0f);
+    static_cast<Storage::base_type&>(mixin).remove(Entity(1));
+    REQUIRE(destruction_count == 1);
 }
\ No newline at end of file
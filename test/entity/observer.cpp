@@ -0,0 +1,109 @@
+#include "wecs/wecs.hpp"
+#include "wecs/entity/observer.hpp"
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+using Registry = BasicRegistry<entity, config::page_size>;
+using Observer = BasicObserver<entity, config::page_size>;
+
+struct Position {
+    float x, y;
+};
+
+struct Renderable {
+    int layer;
+};
+
+struct Hidden {
+    bool value;
+};
+
+TEST_CASE("observer") {
+    Registry registry;
+
+    SECTION("update") {
+        Observer observer{registry};
+        observer.update<Position, Require<Renderable>>();
+
+        auto entity_1 = registry.create();
+        auto entity_2 = registry.create();
+        registry.emplace<Position>(entity_1, Position{1.0f, 2.0f});
+        registry.emplace<Position>(entity_2, Position{3.0f, 4.0f});
+        registry.emplace<Renderable>(entity_1, Renderable{0});
+        REQUIRE(observer.empty());
+
+        registry.patch<Position>(entity_1, [](auto& pos) { pos.x += 1.0f; });
+        registry.patch<Position>(entity_2, [](auto& pos) { pos.x += 1.0f; });
+        registry.replace<Position>(entity_1, Position{5.0f, 6.0f});
+        REQUIRE(observer.size() == 1);
+        REQUIRE(observer.contain(entity_1));
+        REQUIRE_FALSE(observer.contain(entity_2));
+
+        observer.clear();
+        REQUIRE(observer.empty());
+
+        registry.patch<Position>(entity_1, [](auto& pos) { pos.y += 1.0f; });
+        REQUIRE(observer.contain(entity_1));
+        registry.remove<Renderable>(entity_1);
+        REQUIRE(observer.empty());
+    }
+
+    SECTION("construct") {
+        Observer observer{registry};
+        observer.construct<Position, Require<>, Exclude<Hidden>>();
+
+        auto entity_1 = registry.create();
+        auto entity_2 = registry.create();
+        registry.emplace<Hidden>(entity_2, Hidden{true});
+        registry.emplace<Position>(entity_1, Position{1.0f, 2.0f});
+        registry.emplace<Position>(entity_2, Position{3.0f, 4.0f});
+        REQUIRE(observer.size() == 1);
+
+        size_t count = 0;
+        observer.each([&](auto entity) {
+            REQUIRE(entity == entity_1);
+            count++;
+        });
+        REQUIRE(count == 1);
+
+        registry.emplace<Hidden>(entity_1, Hidden{true});
+        REQUIRE(observer.empty());
+    }
+
+    SECTION("destroy") {
+        Observer observer{registry};
+        observer.construct<Position>();
+
+        auto entity_1 = registry.create();
+        registry.emplace<Position>(entity_1, Position{1.0f, 2.0f});
+        REQUIRE(observer.contain(entity_1));
+        registry.destroy(entity_1);
+        REQUIRE(observer.empty());
+
+        auto entity_2 = registry.create();
+        REQUIRE(to_entity(entity_2) == to_entity(entity_1));
+        registry.emplace<Position>(entity_2, Position{1.0f, 2.0f});
+        REQUIRE(registry.has<Position>(entity_2));
+        REQUIRE_FALSE(observer.contain(entity_1));
+        REQUIRE(observer.contain(entity_2));
+    }
+
+    SECTION("disconnect") {
+        {
+            Observer observer{registry};
+            observer.update<Position>();
+        }
+        auto entity_1 = registry.create();
+        registry.emplace<Position>(entity_1, Position{1.0f, 2.0f});
+        registry.patch<Position>(entity_1);
+
+        Observer observer{registry};
+        observer.update<Position>();
+        observer.disconnect();
+        registry.patch<Position>(entity_1);
+        REQUIRE(observer.empty());
+    }
+}
@@ -0,0 +1,136 @@
+#include "wecs/wecs.hpp"
+#include <random>
+#include <set>
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+struct Score {
+    int value;
+};
+
+struct Name {
+    const char* value;
+};
+
+using score_index = registry::ordered_index_type<Score, int>;
+
+std::vector<entity> collect(score_index::Range range) {
+    return std::vector<entity>(range.begin(), range.end());
+}
+
+TEST_CASE("ordered index") {
+    registry registry;
+
+    SECTION("ranges") {
+        auto low = registry.create();
+        registry.emplace<Score>(low, 10);
+
+        auto& index = registry.ordered_index<Score>(&Score::value);
+        REQUIRE(&index == &registry.ordered_index<Score>(&Score::value));
+
+        auto mid = registry.create();
+        auto high = registry.create();
+        registry.emplace<Score>(mid, 20);
+        registry.emplace<Score>(high, 30);
+        REQUIRE(index.size() == 3);
+        REQUIRE(collect(index.range(15, 31)) == std::vector<entity>{mid, high});
+        REQUIRE(collect(index.range(10, 20)) == std::vector<entity>{low});
+        REQUIRE(collect(index.range(31, 40)).empty());
+        REQUIRE(collect(index.equal_range(20)) == std::vector<entity>{mid});
+        REQUIRE(index.lower_bound(11).key() == 20);
+        REQUIRE(index.upper_bound(30) == index.end());
+
+        registry.replace<Score>(low, 40);
+        REQUIRE(std::vector<entity>(index.begin(), index.end()) == std::vector<entity>{mid, high, low});
+
+        registry.get_mutable<Score>(high).value = 5;
+        index.refresh(high);
+        REQUIRE(*index.begin() == high);
+
+        registry.destroy(mid);
+        REQUIRE(std::vector<entity>(index.begin(), index.end()) == std::vector<entity>{high, low});
+
+        registry.clear();
+        REQUIRE(index.empty());
+        REQUIRE(index.begin() == index.end());
+    }
+
+    SECTION("join") {
+        auto& index = registry.ordered_index<Score>(&Score::value);
+        for (int i = 0; i < 100; i++) {
+            auto created = registry.create();
+            registry.emplace<Score>(created, 100 - i);
+            if (i % 2 == 0) {
+                registry.emplace<Name>(created, "even");
+            }
+        }
+
+        // ascending scores in [10, 20) that also have a name
+        std::vector<int> scores;
+        auto range = index.range(10, 20);
+        registry.each<Score, Name>(range.begin(), range.end(), [&scores](entity, Score& score, Name&) {
+            scores.push_back(score.value);
+        });
+        REQUIRE(scores == std::vector<int>{10, 12, 14, 16, 18});
+
+        REQUIRE(registry.view<Score, Name>(range.begin(), range.end()).size() == 5);
+    }
+
+    SECTION("random") {
+        // duplicated keys and enough entities for several levels of splits and merges
+        auto& index = registry.ordered_index<Score>(&Score::value);
+        std::mt19937 engine{5};
+        std::multiset<std::pair<int, uint32_t>> expected;
+        std::vector<entity> entities;
+        for (size_t i = 0; i < 20000; i++) {
+            auto created = registry.create();
+            const auto value = static_cast<int>(engine() % 1000u);
+            registry.emplace<Score>(created, value);
+            entities.push_back(created);
+        }
+        REQUIRE(index.height() > 2);
+        for (size_t i = 0; i < 30000; i++) {
+            auto target = entities[engine() % entities.size()];
+            if (!registry.alive(target)) {
+                continue;
+            }
+            if (engine() % 2u) {
+                registry.replace<Score>(target, static_cast<int>(engine() % 1000u));
+            } else {
+                registry.destroy(target);
+            }
+        }
+        for (auto [holder, score] : registry.view<Score>()) {
+            expected.emplace(score.value, to_integral(holder));
+        }
+
+        REQUIRE(index.size() == expected.size());
+        auto it = expected.begin();
+        for (auto pos = index.begin(); pos != index.end(); ++pos, ++it) {
+            REQUIRE(pos.key() == it->first);
+            REQUIRE(to_integral(*pos) == it->second);
+        }
+
+        for (int lower = 0; lower < 1000; lower += 37) {
+            size_t count = 0;
+            for (auto holder : index.range(lower, lower + 50)) {
+                const auto value = registry.get<Score>(holder).value;
+                REQUIRE((value >= lower && value < lower + 50));
+                count++;
+            }
+            const auto first = expected.lower_bound({lower, 0u});
+            const auto last = expected.lower_bound({lower + 50, 0u});
+            REQUIRE(count == static_cast<size_t>(std::distance(first, last)));
+        }
+
+        // emptying it merges everything back into one leaf
+        for (auto created : entities) {
+            registry.destroy(created);
+        }
+        REQUIRE(index.empty());
+        REQUIRE(index.height() == 1);
+    }
+}
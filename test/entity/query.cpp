@@ -0,0 +1,77 @@
+#include "wecs/wecs.hpp"
+#include <algorithm>
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Frozen {};
+struct Visible {};
+
+TEST_CASE("query") {
+    registry registry;
+    query<Position, const Velocity> moving = registry.query<Position, const Velocity>();
+    auto thawed = registry.query<Position, const Velocity>(exclude<Frozen>);
+    REQUIRE(moving.size_hint() == 0);
+    REQUIRE(moving.begin() == moving.end());
+
+    std::vector<entity> entities;
+    for (size_t i = 0; i < 100; i++) {
+        auto created = registry.create();
+        entities.push_back(created);
+        registry.emplace<Position>(created, 0.f, 0.f);
+        if (i % 2 == 0) {
+            registry.emplace<Velocity>(created, 1.f, 2.f);
+        }
+        if (i % 4 == 0) {
+            registry.emplace<Frozen>(created);
+        }
+    }
+
+    // pools created after the query was built are still the ones it walks
+    REQUIRE(moving.size_hint() == 50);
+    size_t count = 0;
+    moving.each([&count](entity, Position& position, const Velocity& velocity) {
+        position.x += velocity.x;
+        count++;
+    });
+    REQUIRE(count == 50);
+    REQUIRE(registry.get<Position>(entities[0]).x == 1.f);
+    REQUIRE(registry.get<Position>(entities[1]).x == 0.f);
+
+    std::vector<entity> seen;
+    for (auto [holder, position, velocity] : thawed) {
+        REQUIRE_FALSE(registry.has<Frozen>(holder));
+        position.y += velocity.y;
+        seen.push_back(holder);
+    }
+    REQUIRE(seen.size() == 25);
+    REQUIRE(thawed.contain(entities[2]));
+    REQUIRE_FALSE(thawed.contain(entities[4]));
+    REQUIRE_FALSE(thawed.contain(entities[3]));
+
+    // matches follow later changes, and each may remove what it is given
+    registry.remove<Frozen>(entities[0]);
+    thawed.each([&registry](entity holder, Position&, const Velocity&) { registry.remove<Velocity>(holder); });
+    REQUIRE(registry.storage<Velocity>().size() == 24);
+    REQUIRE(thawed.begin() == thawed.end());
+
+    // tags may be included when a component leads
+    auto visible = registry.query<Position, Visible>();
+    registry.emplace<Visible>(entities[7]);
+    count = 0;
+    visible.each([&count, &entities](entity holder, Position&, Visible) {
+        REQUIRE(holder == entities[7]);
+        count++;
+    });
+    REQUIRE(count == 1);
+}
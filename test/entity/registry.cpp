@@ -1,5 +1,6 @@
 #include "wecs/wecs.hpp"
 #include "wecs/entity/registry.hpp"
+#include <thread>
 
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
@@ -26,6 +27,38 @@ struct Component4 {
     double d;
 };
 
+struct Component5 {
+    static constexpr bool signal = false;
+
+    int a;
+};
+
+struct Component6 {
+    static constexpr bool track_ticks = true;
+
+    int a;
+};
+
+struct Component7 {
+    float x, y;
+
+    static constexpr auto fields = std::make_tuple(&Component7::x, &Component7::y);
+};
+
+void double_on_construct(Registry& registry, entity entity) {
+    registry.patch<Component1>(entity, [](auto& component) { component.a *= 2; });
+}
+
+// moved components are still intact when the source registry lets go of them
+void count_moved(size_t& destroyed, entity, Component2& comp) {
+    REQUIRE(comp.str == "moved");
+    destroyed++;
+}
+
+void count_constructed(size_t& constructed, entity, Component2&) {
+    constructed++;
+}
+
 TEST_CASE("registry") {
     Registry registry;
 
@@ -90,6 +123,30 @@ TEST_CASE("registry") {
         REQUIRE(registry.has<Component1>(entity_1));
     }
 
+    SECTION("get") {
+        auto entity_1 = registry.create();
+        auto entity_2 = registry.create();
+        registry.emplace<Component1>(entity_1, Component1{1});
+        registry.emplace<Component2>(entity_1, Component2{"one"});
+        registry.emplace<Component3>(entity_1, Component3{1.5f});
+        registry.emplace<Component1>(entity_2, Component1{2});
+
+        auto [comp_1, comp_2, comp_3] = registry.get<Component1, Component2, Component3>(entity_1);
+        REQUIRE(comp_1.a == 1);
+        REQUIRE(comp_2.str == "one");
+        REQUIRE(comp_3.f == 1.5f);
+        REQUIRE(&comp_1 == &registry.get<Component1>(entity_1));
+
+        auto [ptr_1, ptr_2, ptr_4] = registry.try_get<Component1, Component2, Component4>(entity_2);
+        REQUIRE(ptr_1 == &registry.get<Component1>(entity_2));
+        REQUIRE(ptr_2 == nullptr);
+        REQUIRE(ptr_4 == nullptr);
+        REQUIRE(registry.try_get<Component2>(entity_1)->str == "one");
+
+        registry.destroy(entity_1);
+        REQUIRE(registry.try_get<Component1>(entity_1) == nullptr);
+    }
+
     SECTION("view") {
         auto entity_1 = registry.create();
         auto entity_2 = registry.create();
@@ -123,4 +180,246 @@ TEST_CASE("registry") {
             assert(false);
         } 
     }
-}
\ No newline at end of file
+
+    SECTION("each") {
+        std::vector<entity> entities;
+        for (int i = 0; i < 100; i++) {
+            entities.push_back(registry.create());
+            registry.emplace<Component1>(entities.back(), Component1{i});
+        }
+        // a packed order unrelated to the one of Component1
+        for (auto it = entities.rbegin(); it != entities.rend(); it += 2) {
+            registry.emplace<Component3>(*it, Component3{1.0f});
+        }
+
+        std::vector<entity> iterated;
+        for (auto [entity, comp1, comp3] : registry.view<Component1, Component3>()) {
+            iterated.push_back(entity);
+        }
+        std::vector<entity> visited;
+        registry.view<Component1, Component3>().each([&visited](entity entity, Component1& comp1, Component3& comp3) {
+            comp3.f += static_cast<float>(comp1.a);
+            visited.push_back(entity);
+        });
+        REQUIRE(visited == iterated);
+        REQUIRE(visited.size() == 50);
+        for (auto entity : visited) {
+            REQUIRE(registry.get<Component3>(entity).f == static_cast<float>(registry.get<Component1>(entity).a) + 1.0f);
+        }
+    }
+
+    SECTION("signal") {
+        static_assert(std::is_same_v<Registry::storage_for_t<Component1>,
+                                     SighMixin<BasicStorage<entity, Component1, config::page_size, std::allocator<Component1>>>>);
+        static_assert(std::is_same_v<Registry::storage_for_t<Component5>,
+                                     BasicStorage<entity, Component5, config::page_size, std::allocator<Component5>>>);
+
+        auto entity_1 = registry.create();
+        registry.emplace<Component5>(entity_1, Component5{10});
+        REQUIRE(registry.has<Component5>(entity_1));
+        REQUIRE(registry.patch<Component5>(entity_1, [](auto& comp) { comp.a++; }).a == 11);
+
+        registry.destroy(entity_1);
+        REQUIRE_FALSE(registry.has<Component5>(entity_1));
+    }
+
+    SECTION("ticks") {
+        auto entity_1 = registry.create();
+        auto entity_2 = registry.create();
+        auto entity_3 = registry.create();
+        registry.emplace<Component6>(entity_1, Component6{1});
+        registry.emplace<Component6>(entity_2, Component6{2});
+        registry.emplace<Component1>(entity_1, Component1{1});
+        registry.emplace<Component1>(entity_2, Component1{2});
+
+        auto since = registry.advance();
+        REQUIRE(since == registry.tick());
+        registry.emplace<Component6>(entity_3, Component6{3});
+        registry.emplace<Component1>(entity_3, Component1{3});
+        registry.patch<Component6>(entity_1, [](auto& comp) { comp.a++; });
+
+        auto changed = registry.view<Component6, Component1>().changed<Component6>(since);
+        REQUIRE(changed.size() == 2);
+        auto added = registry.view<Component6>().added<Component6>(since);
+        REQUIRE(added.size() == 1);
+        REQUIRE(added.entities()[0] == to_integral(entity_3));
+
+        since = registry.advance();
+        registry.replace<Component6>(entity_2, Component6{20});
+        registry.get_mutable<Component6>(entity_3).a = 30;
+        registry.remove<Component6>(entity_1);
+        changed = registry.view<Component6, Component1>().changed<Component6>(since);
+        REQUIRE(changed.size() == 2);
+        REQUIRE(registry.view<Component6>().changed<Component6>(registry.advance()).empty());
+    }
+
+    SECTION("memory") {
+        auto entity_1 = registry.create();
+        registry.emplace<Component1>(entity_1, Component1{1});
+        registry.on_construct<Component1>().connect<&Registry::alive>(registry);
+        auto usage = registry.memory_usage();
+        REQUIRE(usage.payload.used >= sizeof(Component1));
+        REQUIRE(usage.signals.used > 0);
+
+        registry.remove<Component1>(entity_1);
+        registry.shrink_to_fit();
+        REQUIRE(registry.memory_usage().payload.used == 0);
+        REQUIRE(registry.alive(entity_1));
+    }
+
+    SECTION("concurrent read") {
+        registry.prepare<Component1, Component3>();
+        for (int i = 0; i < 100; i++) {
+            auto entity = registry.create();
+            registry.emplace<Component1>(entity, Component1{i});
+            if (i % 2 == 0) {
+                registry.emplace<Component3>(entity, Component3{static_cast<float>(i)});
+            }
+        }
+
+        const Registry& reader = registry;
+        std::vector<int> sums(4);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < sums.size(); t++) {
+            threads.emplace_back([&reader, &sums, t] {
+                for (auto [entity, component1, component3] : reader.view<Component1, Component3>()) {
+                    if (reader.has<Component3>(entity) && reader.get<Component3>(entity).f == component3.f) {
+                        sums[t] += component1.a;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto sum : sums) {
+            REQUIRE(sum == 2450);
+        }
+        REQUIRE(reader.view<Component4>().empty());
+        REQUIRE_FALSE(reader.storage(Registry::component_ident::get<Component4>()));
+    }
+
+    SECTION("nested write") {
+        registry.on_construct<Component1>().connect<&double_on_construct>(registry);
+        auto entity = registry.create();
+        registry.emplace<Component1>(entity, Component1{1});
+        REQUIRE(registry.get<Component1>(entity).a == 2);
+    }
+
+    SECTION("move") {
+        Registry zone;
+        size_t destroyed = 0;
+        registry.on_destruction<Component2>().connect<&count_moved>(destroyed);
+
+        std::vector<entity> entities;
+        for (int i = 0; i < 10; i++) {
+            auto created = registry.create();
+            entities.push_back(created);
+            registry.emplace<Component1>(created, Component1{i});
+            if (i % 2 == 0) {
+                registry.emplace<Component2>(created, Component2{"moved"});
+            }
+            if (i % 3 == 0) {
+                registry.emplace<Component7>(created, static_cast<float>(i), 0.0f);
+            }
+        }
+        auto resident = zone.create();
+        zone.emplace<Component1>(resident, Component1{-1});
+
+        std::vector<entity> moved;
+        registry.move_to(zone, entities.begin() + 2, entities.end(), std::back_inserter(moved));
+        REQUIRE(moved.size() == 8);
+        REQUIRE(registry.size() == 2);
+        REQUIRE_FALSE(registry.alive(entities[2]));
+        REQUIRE(registry.storage<Component1>().size() == 2);
+        REQUIRE(registry.storage<Component2>().size() == 1);
+        REQUIRE(destroyed == 4);
+
+        REQUIRE(zone.size() == 9);
+        REQUIRE(zone.get<Component1>(resident).a == -1);
+        for (int i = 2; i < 10; i++) {
+            auto target = moved[static_cast<size_t>(i - 2)];
+            REQUIRE(zone.get<Component1>(target).a == i);
+            REQUIRE(zone.has<Component2>(target) == (i % 2 == 0));
+            REQUIRE(zone.has<Component7>(target) == (i % 3 == 0));
+        }
+        REQUIRE(zone.get<Component2>(moved[0]).str == "moved");
+        REQUIRE(zone.get<Component7>(moved[1]).get<0>() == 3.0f);
+    }
+
+    SECTION("clone") {
+        size_t constructed = 0;
+        registry.on_construct<Component2>().connect<&count_constructed>(constructed);
+
+        std::vector<entity> entities;
+        for (int i = 0; i < 3000; i++) {
+            auto created = registry.create();
+            entities.push_back(created);
+            registry.emplace<Component1>(created, Component1{i});
+            if (i % 2 == 0) {
+                registry.emplace<Component2>(created, Component2{std::to_string(i)});
+            }
+            if (i % 3 == 0) {
+                registry.emplace<Component7>(created, static_cast<float>(i), 1.0f);
+            }
+        }
+        registry.destroy(entities[5]);
+        registry.advance();
+        registry.emplace<Component6>(entities[0], Component6{1});
+
+        auto copy = registry.clone();
+        REQUIRE(copy.size() == registry.size());
+        REQUIRE_FALSE(copy.alive(entities[5]));
+        REQUIRE(copy.tick() == registry.tick());
+        REQUIRE(copy.storage<Component6>().added(entities[0]) == registry.tick());
+        REQUIRE(copy.storage<Component1>().packed() == registry.storage<Component1>().packed());
+        for (auto [holder, comp] : registry.view<Component1>()) {
+            REQUIRE(copy.get<Component1>(holder).a == comp.a);
+            REQUIRE(copy.has<Component2>(holder) == registry.has<Component2>(holder));
+            REQUIRE(copy.has<Component7>(holder) == registry.has<Component7>(holder));
+        }
+        REQUIRE(copy.get<Component2>(entities[2998]).str == "2998");
+        REQUIRE(copy.get<Component7>(entities[2997]).get<0>() == 2997.0f);
+
+        // the copies are independent, and listeners stay with the original
+        copy.replace<Component2>(entities[0], Component2{"copy"});
+        copy.destroy(entities[2]);
+        copy.emplace<Component2>(entities[1], Component2{"new"});
+        REQUIRE(registry.get<Component2>(entities[0]).str == "0");
+        REQUIRE(registry.alive(entities[2]));
+        REQUIRE(constructed == 1500);
+
+        auto listened = registry.clone(true);
+        listened.emplace<Component2>(entities[1], Component2{"new"});
+        REQUIRE(constructed == 1501);
+        // the entity pool, free list included, is copied as it was
+        REQUIRE(listened.create() == registry.create());
+    }
+
+    SECTION("soa") {
+        auto entity_1 = registry.create();
+        auto entity_2 = registry.create();
+        registry.emplace<Component7>(entity_1, 1.0f, 2.0f);
+        registry.emplace<Component7>(entity_2, 3.0f, 4.0f);
+        registry.emplace<Component1>(entity_2, Component1{5});
+        REQUIRE(registry.get<Component7>(entity_1).get<1>() == 2.0f);
+
+        registry.patch<Component7>(entity_1, [](auto& component) { component.x = 10.0f; });
+        registry.replace<Component7>(entity_2, 30.0f, 40.0f);
+        registry.get_mutable<Component7>(entity_2).get<1>() += 1.0f;
+
+        float sum = 0;
+        for (auto [entity, component7] : registry.view<Component7>()) {
+            sum += component7.get<0>() + component7.get<1>();
+        }
+        REQUIRE(sum == 83.0f);
+        for (auto [entity, component7, component1] : registry.view<Component7, Component1>()) {
+            REQUIRE(entity == entity_2);
+            component7 = Component7{component7.get<0>(), static_cast<float>(component1.a)};
+        }
+        REQUIRE(static_cast<Component7>(registry.get<Component7>(entity_2)).y == 5.0f);
+
+        registry.destroy(entity_1);
+        REQUIRE(registry.storage<Component7>().size() == 1);
+    }
+}
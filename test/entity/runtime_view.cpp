@@ -0,0 +1,89 @@
+#include "wecs/wecs.hpp"
+#include "wecs/entity/runtime_view.hpp"
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+using Registry = BasicRegistry<entity, config::page_size>;
+using RuntimeView = BasicRuntimeView<entity, config::page_size>;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Frozen {
+    bool value;
+};
+
+TEST_CASE("runtime view") {
+    Registry registry;
+
+    auto entity_1 = registry.create();
+    auto entity_2 = registry.create();
+    auto entity_3 = registry.create();
+    registry.emplace<Position>(entity_1, Position{1.0f, 1.0f});
+    registry.emplace<Position>(entity_2, Position{2.0f, 2.0f});
+    registry.emplace<Position>(entity_3, Position{3.0f, 3.0f});
+    registry.emplace<Velocity>(entity_2, Velocity{1.0f, 0.0f});
+    registry.emplace<Velocity>(entity_3, Velocity{1.0f, 0.0f});
+    registry.emplace<Frozen>(entity_3, Frozen{true});
+
+    auto position_id = Registry::component_ident::get<Position>();
+    auto velocity_id = Registry::component_ident::get<Velocity>();
+    auto frozen_id = Registry::component_ident::get<Frozen>();
+
+    SECTION("iterate") {
+        RuntimeView view;
+        REQUIRE(view.begin() == view.end());
+        REQUIRE(view.size_hint() == 0);
+
+        view.iterate(*registry.storage(position_id)).iterate(*registry.storage(velocity_id));
+        REQUIRE(view.size_hint() == 2);
+        REQUIRE(view.contain(entity_2));
+        REQUIRE_FALSE(view.contain(entity_1));
+
+        size_t count = 0;
+        for (auto entity : view) {
+            REQUIRE((entity == entity_2 || entity == entity_3));
+            count++;
+        }
+        REQUIRE(count == 2);
+
+        view.exclude(*registry.storage(frozen_id));
+        count = 0;
+        view.each([&](auto entity) {
+            REQUIRE(entity == entity_2);
+            count++;
+        });
+        REQUIRE(count == 1);
+        REQUIRE_FALSE(view.contain(entity_3));
+    }
+
+    SECTION("value") {
+        RuntimeView view;
+        view.iterate(*registry.storage(velocity_id)).iterate(*registry.storage(position_id));
+
+        auto* pool = registry.storage(position_id);
+        for (auto entity : view) {
+            static_cast<Position*>(pool->value(entity))->x += 10.0f;
+        }
+        REQUIRE(registry.get<Position>(entity_1).x == 1.0f);
+        REQUIRE(registry.get<Position>(entity_2).x == 12.0f);
+        REQUIRE(registry.get<Position>(entity_3).x == 13.0f);
+    }
+
+    SECTION("empty") {
+        RuntimeView view;
+        registry.remove<Velocity>(entity_2);
+        registry.remove<Velocity>(entity_3);
+        view.iterate(*registry.storage(position_id)).iterate(*registry.storage(velocity_id));
+        REQUIRE(view.begin() == view.end());
+        REQUIRE(registry.storage(Registry::component_ident::get<struct Unknown>()) == nullptr);
+    }
+}
@@ -0,0 +1,102 @@
+#include "wecs/wecs.hpp"
+#include "wecs/entity/soa_storage.hpp"
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+#define Entity(x) static_cast<entity>(x)
+
+struct Particle {
+    float x, y, vx, vy;
+
+    static constexpr auto fields = std::make_tuple(&Particle::x, &Particle::y, &Particle::vx, &Particle::vy);
+};
+
+struct Label {
+    int id;
+    std::string str;
+
+    static constexpr auto fields = std::make_tuple(&Label::id, &Label::str);
+};
+
+TEST_CASE("soa storage") {
+    BasicSoaStorage<entity, Particle, config::page_size> storage;
+    REQUIRE(storage.empty());
+
+    auto p1 = storage.emplace(Entity(0), 1.0f, 2.0f, 0.5f, 0.25f);
+    REQUIRE(p1.get<0>() == 1.0f);
+    REQUIRE(p1.get<3>() == 0.25f);
+    storage.emplace(Entity(1), Particle{3.0f, 4.0f, 1.0f, 1.0f});
+    REQUIRE(storage.size() == 2);
+
+    Particle particle = storage[Entity(1)];
+    REQUIRE(particle.x == 3.0f);
+    REQUIRE(particle.vy == 1.0f);
+
+    storage[Entity(0)].get<1>() = 20.0f;
+    REQUIRE(storage.field<1>(0)[0] == 20.0f);
+    storage[Entity(1)] = Particle{5.0f, 6.0f, 7.0f, 8.0f};
+    REQUIRE(storage.field<0>(0)[1] == 5.0f);
+
+    auto p2 = storage.patch(Entity(0), [](Particle& p) { p.x = 10.0f; });
+    REQUIRE(p2.get<0>() == 10.0f);
+    REQUIRE(p2.get<1>() == 20.0f);
+
+    // the last element is moved into the hole, field by field
+    storage.remove(Entity(0));
+    REQUIRE(storage.size() == 1);
+    REQUIRE(storage.field<3>(0)[0] == 8.0f);
+    REQUIRE(static_cast<Particle>(std::as_const(storage)[Entity(1)]).vx == 7.0f);
+
+    storage.clear();
+    storage.shrink_to_fit();
+    REQUIRE(storage.empty());
+    REQUIRE(storage.memory_usage().payload.reserved == 0);
+}
+
+TEST_CASE("soa each") {
+    BasicSoaStorage<entity, Particle, config::page_size> storage;
+    const auto count = 3 * ComponentTraits<Particle>::page_size + 10;
+    for (uint32_t i = 0; i < count; i++) {
+        storage.emplace(Entity(i), static_cast<float>(i), 0.0f, 1.0f, 2.0f);
+    }
+
+    size_t pages = 0;
+    size_t visited = 0;
+    storage.each([&](size_t size, float* x, float* y, float* vx, float* vy) {
+        REQUIRE(reinterpret_cast<uintptr_t>(x) % decltype(storage)::page_align == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(vy) % decltype(storage)::page_align == 0);
+        for (size_t i = 0; i < size; i++) {
+            x[i] += vx[i];
+            y[i] += vy[i];
+        }
+        pages++;
+        visited += size;
+    });
+    REQUIRE(pages == 4);
+    REQUIRE(visited == count);
+    for (uint32_t i = 0; i < count; i++) {
+        REQUIRE(storage[Entity(i)].get<0>() == static_cast<float>(i) + 1.0f);
+        REQUIRE(storage[Entity(i)].get<1>() == 2.0f);
+    }
+
+    auto usage = storage.memory_usage();
+    REQUIRE(usage.payload.used >= count * sizeof(Particle));
+    for (uint32_t i = 10; i < count; i++) {
+        storage.remove(Entity(i));
+    }
+    storage.shrink_to_fit();
+    REQUIRE(storage.pages().size() == 1);
+    REQUIRE(storage.memory_usage().payload.reserved < usage.payload.reserved);
+}
+
+TEST_CASE("soa non trivial fields") {
+    BasicSoaStorage<entity, Label, config::page_size> storage;
+    storage.emplace(Entity(0), 1, std::string(64, 'a'));
+    storage.emplace(Entity(1), 2, std::string(64, 'b'));
+    storage.remove(Entity(0));
+    REQUIRE(storage[Entity(1)].get<0>() == 2);
+    REQUIRE(storage[Entity(1)].get<1>() == std::string(64, 'b'));
+}
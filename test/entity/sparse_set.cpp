@@ -131,4 +131,24 @@ TEST_CASE("index") {
     REQUIRE(sparse_set.index(Entity(3)) == std::numeric_limits<size_t>::max()); // npos
     REQUIRE(sparse_set.index(Entity(2)) == 2);
     REQUIRE(sparse_set.index(Entity(4)) == 1);
-}
\ No newline at end of file
+}
+TEST_CASE("contain mask") {
+    SparseSet sparse_set;
+    std::vector<SparseSet::entity_type> entities;
+    for (uint32_t i = 0; i < 40; i++) {
+        if (i % 3) {
+            sparse_set.insert(Entity(i));
+        }
+        entities.push_back(i);
+    }
+    entities.push_back(0x100000 | 1u); // stale version
+    entities.push_back(100000);        // out of sparse range
+
+    for (size_t first = 0; first < entities.size(); first++) {
+        const auto count = std::min<size_t>(16, entities.size() - first);
+        const auto mask = sparse_set.contain_mask(entities.data() + first, count);
+        for (size_t i = 0; i < count; i++) {
+            REQUIRE(static_cast<bool>(mask & (1u << i)) == sparse_set.contain(Entity(entities[first + i])));
+        }
+    }
+}
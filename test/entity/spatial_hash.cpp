@@ -0,0 +1,121 @@
+#include "wecs/wecs.hpp"
+#include "wecs/entity/spatial_hash.hpp"
+#include <algorithm>
+#include <random>
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+using position_hash = spatial_hash<&Position::x, &Position::y>;
+
+std::vector<entity> sorted(std::vector<entity> entities) {
+    std::sort(entities.begin(), entities.end());
+    return entities;
+}
+
+// entities within radius of (x, y), found by looking at every one
+std::vector<entity> scan(registry& registry, float x, float y, float radius) {
+    std::vector<entity> result;
+    for (auto [entity, position] : registry.view<Position>()) {
+        const auto dx = position.x - x;
+        const auto dy = position.y - y;
+        if (dx * dx + dy * dy <= radius * radius) {
+            result.push_back(entity);
+        }
+    }
+    return sorted(result);
+}
+
+TEST_CASE("spatial hash") {
+    registry registry;
+
+    SECTION("signals") {
+        auto existing = registry.create();
+        registry.emplace<Position>(existing, 1.f, 1.f);
+
+        position_hash index{registry, 4.f};
+        REQUIRE(index.size() == 1);
+
+        auto near = registry.create();
+        auto far = registry.create();
+        registry.emplace<Position>(near, -1.f, 2.f);
+        registry.emplace<Position>(far, 20.f, 20.f);
+        REQUIRE(index.size() == 3);
+        REQUIRE(sorted(index.query(0.f, 0.f, 3.f)) == sorted({existing, near}));
+
+        // moving across cells and within a cell
+        registry.replace<Position>(far, 0.f, 1.f);
+        registry.patch<Position>(near, [](auto& position) { position.x = -1.5f; });
+        REQUIRE(sorted(index.query(0.f, 0.f, 3.f)) == sorted({existing, near, far}));
+        REQUIRE(index.query(20.f, 20.f, 1.f).empty());
+
+        registry.remove<Position>(existing);
+        registry.destroy(near);
+        REQUIRE(index.size() == 1);
+        REQUIRE(index.query(0.f, 0.f, 3.f) == std::vector<entity>{far});
+    }
+
+    SECTION("refresh") {
+        position_hash index{registry, 4.f};
+        auto moved = registry.create();
+        registry.emplace<Position>(moved, 0.f, 0.f);
+
+        registry.get_mutable<Position>(moved) = {10.f, 10.f};
+        REQUIRE(index.query(10.f, 10.f, 1.f).empty());
+        index.refresh(moved);
+        REQUIRE(index.query(10.f, 10.f, 1.f) == std::vector<entity>{moved});
+        REQUIRE(index.query(0.f, 0.f, 1.f).empty());
+    }
+
+    SECTION("random") {
+        position_hash index{registry, 5.f};
+        std::mt19937 engine{7};
+        std::uniform_real_distribution<float> coord{-50.f, 50.f};
+        std::vector<entity> entities;
+        for (size_t i = 0; i < 2000; i++) {
+            auto entity = registry.create();
+            registry.emplace<Position>(entity, coord(engine), coord(engine));
+            entities.push_back(entity);
+        }
+        for (size_t i = 0; i < entities.size(); i += 3) {
+            registry.replace<Position>(entities[i], coord(engine), coord(engine));
+        }
+        for (size_t i = 0; i < entities.size(); i += 7) {
+            registry.destroy(entities[i]);
+        }
+
+        for (size_t i = 0; i < 50; i++) {
+            const auto x = coord(engine), y = coord(engine);
+            REQUIRE(sorted(index.query(x, y, 8.f)) == scan(registry, x, y, 8.f));
+        }
+        REQUIRE(index.size() == registry.storage<Position>().size());
+    }
+
+    SECTION("view") {
+        position_hash index{registry, 4.f};
+        auto moving = registry.create();
+        auto still = registry.create();
+        registry.emplace<Position>(moving, 1.f, 0.f);
+        registry.emplace<Velocity>(moving, 2.f, 0.f);
+        registry.emplace<Position>(still, 0.f, 1.f);
+
+        auto found = index.query(0.f, 0.f, 2.f);
+        auto view = registry.view<Position, Velocity>(found.begin(), found.end());
+        REQUIRE(view.size() == 1);
+        for (auto [entity, position, velocity] : view) {
+            REQUIRE(entity == moving);
+            position.x += velocity.x;
+        }
+        REQUIRE(registry.get<Position>(moving).x == 3.f);
+    }
+}
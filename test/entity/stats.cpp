@@ -0,0 +1,67 @@
+#define WECS_ENABLE_STATS
+#include "wecs/wecs.hpp"
+#include "wecs/entity/registry.hpp"
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <sstream>
+
+using namespace wecs;
+
+using Registry = BasicRegistry<entity, config::page_size>;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+TEST_CASE("stats") {
+    Registry registry;
+
+    auto entity_1 = registry.create();
+    auto entity_2 = registry.create();
+    auto entity_3 = registry.create();
+    registry.emplace<Position>(entity_1, Position{1.0f, 1.0f});
+    registry.emplace<Position>(entity_2, Position{2.0f, 2.0f});
+    registry.emplace<Position>(entity_3, Position{3.0f, 3.0f});
+    registry.emplace<Velocity>(entity_2, Velocity{1.0f, 0.0f});
+    registry.patch<Position>(entity_2, [](auto& pos) { pos.x += 1.0f; });
+    registry.remove<Position>(entity_3);
+    registry.destroy(entity_1);
+
+    auto view = registry.view<Position, Velocity>();
+    for (auto&& [entity, pos, vel] : view) {
+        pos.x += vel.x;
+    }
+    registry.view<Position, Velocity>();
+
+    auto stats = registry.stats();
+    REQUIRE(stats.entities == 2);
+    REQUIRE(stats.peak_entities == 3);
+
+    auto position = std::find_if(stats.pools.begin(), stats.pools.end(), [](auto& pool) {
+        return pool.id == Registry::component_ident::get<Position>();
+    });
+    REQUIRE(position != stats.pools.end());
+    REQUIRE(position->emplace == 3);
+    REQUIRE(position->remove == 2);
+    REQUIRE(position->patch == 1);
+    REQUIRE(position->size == 1);
+    REQUIRE(position->peak_size == 3);
+    REQUIRE(position->sparse_pages == 1);
+    REQUIRE(position->sparse_bytes == sizeof(Registry::base_type::page_type));
+    REQUIRE(position->page_allocations > 0);
+
+    REQUIRE(stats.views.size() == 1);
+    REQUIRE(stats.views[0].constructions == 2);
+    REQUIRE(stats.views[0].iterations == 1);
+    REQUIRE(stats.views[0].components.size() == 2);
+
+    std::ostringstream os;
+    stats.dump(os);
+    REQUIRE(os.str().find("entities: 2 (peak 3)") != std::string::npos);
+}
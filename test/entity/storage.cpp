@@ -82,4 +82,80 @@ TEST_CASE("storage") {
 
     storage.clear();
     REQUIRE(storage.empty());
-}
\ No newline at end of file
+}
+TEST_CASE("each") {
+    BasicStorage<entity, Point, config::page_size, std::allocator<Point>> storage;
+    const uint32_t count = 2 * ComponentTraits<Point>::page_size + 3;
+    for (uint32_t i = 0; i < count; i++) {
+        storage.emplace(Entity(i), Point{static_cast<float>(i), 0.0});
+    }
+
+    uint32_t next = 0;
+    storage.each([&next](entity value, Point& point) {
+        REQUIRE(value == Entity(next));
+        REQUIRE(point.x == static_cast<float>(next));
+        point.y = 1.0;
+        next++;
+    });
+    REQUIRE(next == count);
+    REQUIRE(std::all_of(storage.begin(), storage.end(), [](const Point& point) { return point.y == 1.0; }));
+}
+
+TEST_CASE("memory") {
+    BasicStorage<entity, Point, config::page_size, std::allocator<Point>> storage;
+    REQUIRE(storage.memory_usage().reserved() == 0);
+
+    // spread over two payload pages
+    const uint32_t count = ComponentTraits<Point>::page_size + 100;
+    for (uint32_t i = 0; i < count; i++) {
+        storage.emplace(Entity(i), Point{1.0, 2.0});
+    }
+    storage.emplace(Entity(3 * config::page_size), Point{1.0, 2.0});
+    auto usage = storage.memory_usage();
+    REQUIRE(usage.sparse.used == 4 * sizeof(decltype(storage)::page_type));
+    REQUIRE(usage.packed.used == (count + 1) * sizeof(decltype(storage)::entity_type));
+    REQUIRE(usage.payload.used >= (count + 1) * sizeof(Point));
+    REQUIRE(usage.used() <= usage.reserved());
+
+    storage.remove(Entity(3 * config::page_size));
+    for (uint32_t i = 10; i < count; i++) {
+        storage.remove(Entity(i));
+    }
+    storage.shrink_to_fit();
+    auto shrunk = storage.memory_usage();
+    REQUIRE(shrunk.sparse.reserved == sizeof(decltype(storage)::page_type));
+    REQUIRE(shrunk.packed.reserved == 10 * sizeof(decltype(storage)::entity_type));
+    REQUIRE(shrunk.payload.reserved < usage.payload.reserved);
+    for (uint32_t i = 0; i < 10; i++) {
+        REQUIRE(storage[Entity(i)] == Point{1.0, 2.0});
+    }
+
+    storage.clear();
+    storage.shrink_to_fit();
+    REQUIRE(storage.memory_usage().reserved() == 0);
+}
+
+struct alignas(16) Aligned {
+    static constexpr size_t page_alignment = 4096;
+
+    float x, y, z, w;
+};
+
+TEST_CASE("page alignment") {
+    using Storage = BasicStorage<entity, Aligned, config::page_size, AlignedAllocator<Aligned, ComponentTraits<Aligned>::page_alignment>>;
+    STATIC_REQUIRE(std::is_same_v<BasicRegistry<entity, config::page_size>::storage_for_t<Aligned>, SighMixin<Storage>>);
+
+    Storage storage;
+    for (uint32_t i = 0; i < 3 * ComponentTraits<Aligned>::page_size; i++) {
+        storage.emplace(Entity(i * 2), Aligned{1.0f, 2.0f, 3.0f, 4.0f});
+    }
+    REQUIRE(storage.payloads().size() == 3);
+    for (auto* page : storage.payloads()) {
+        REQUIRE(reinterpret_cast<uintptr_t>(page) % 4096 == 0);
+    }
+    REQUIRE(reinterpret_cast<uintptr_t>(storage.sparse().data()) % config::sparse_page_alignment == 0);
+    REQUIRE(storage[Entity(4)].z == 3.0f);
+
+    storage.clear();
+    REQUIRE(storage.payloads().empty());
+}
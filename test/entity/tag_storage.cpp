@@ -0,0 +1,143 @@
+#include "wecs/wecs.hpp"
+#include <algorithm>
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+struct Position {
+    float x, y;
+};
+
+struct Stunned {};
+struct Visible {};
+struct Dirty {};
+
+template <typename View>
+std::vector<entity> entities_of(View&& view) {
+    std::vector<entity> result;
+    for (auto&& tuple : view) {
+        result.push_back(std::get<0>(tuple));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+TEST_CASE("tag set") {
+    BasicTagSet<entity> tags;
+    std::vector<entity> entities;
+    for (uint32_t i = 0; i < 200; i++) {
+        entities.push_back(static_cast<entity>(i));
+    }
+
+    tags.insert(entities[3]);
+    tags.insert(entities[64]);
+    tags.insert(entities[130]);
+    REQUIRE(tags.size() == 3);
+    REQUIRE(tags.words().size() == 3);
+    REQUIRE(tags.contain(entities[64]));
+    REQUIRE_FALSE(tags.contain(entities[65]));
+    REQUIRE_FALSE(tags.contain(entities[199]));
+
+    std::vector<uint32_t> values{3, 4, 64, 130};
+    REQUIRE(tags.contain_mask(values.data(), values.size()) == 0b1101u);
+
+    tags.remove(entities[130]);
+    REQUIRE(tags.size() == 2);
+    tags.shrink_to_fit();
+    REQUIRE(tags.words().size() == 2);
+    REQUIRE(tags.memory_usage().sparse.used == 2 * sizeof(uint64_t));
+
+    tags.clear();
+    REQUIRE(tags.empty());
+    REQUIRE_FALSE(tags.contain(entities[3]));
+}
+
+TEST_CASE("tag storage") {
+    registry registry;
+    static_assert(std::is_same_v<registry::storage_for_t<Stunned>, BasicTagStorage<entity, Stunned>>);
+
+    SECTION("emplace") {
+        auto stunned = registry.create();
+        auto other = registry.create();
+        registry.emplace<Stunned>(stunned);
+        REQUIRE(registry.has<Stunned>(stunned));
+        REQUIRE_FALSE(registry.has<Stunned>(other));
+        REQUIRE_FALSE(registry.has<Visible>(stunned));
+        REQUIRE(registry.storage<Stunned>().size() == 1);
+
+        REQUIRE(registry.try_get<Stunned>(stunned) != nullptr);
+        REQUIRE(registry.try_get<Stunned>(other) == nullptr);
+
+        registry.remove<Stunned>(stunned);
+        REQUIRE_FALSE(registry.has<Stunned>(stunned));
+
+        // the bits of destroyed entities are cleared, and stale handles never match
+        registry.emplace<Stunned>(stunned);
+        registry.destroy(stunned);
+        REQUIRE(registry.storage<Stunned>().empty());
+        auto recycled = registry.create();
+        registry.emplace<Stunned>(recycled);
+        REQUIRE(registry.has<Stunned>(recycled));
+        REQUIRE((recycled == stunned || !registry.has<Stunned>(stunned)));
+    }
+
+    SECTION("view") {
+        std::vector<entity> entities;
+        for (size_t i = 0; i < 300; i++) {
+            auto created = registry.create();
+            entities.push_back(created);
+            registry.emplace<Position>(created, static_cast<float>(i), 0.f);
+            if (i % 2 == 0) {
+                registry.emplace<Visible>(created);
+            }
+            if (i % 3 == 0) {
+                registry.emplace<Stunned>(created);
+            }
+        }
+        std::vector<entity> visible, visible_stunned, visible_moving;
+        for (size_t i = 0; i < entities.size(); i++) {
+            if (i % 2 == 0) {
+                visible.push_back(entities[i]);
+                (i % 3 == 0 ? visible_stunned : visible_moving).push_back(entities[i]);
+            }
+        }
+        std::sort(visible.begin(), visible.end());
+        std::sort(visible_stunned.begin(), visible_stunned.end());
+        std::sort(visible_moving.begin(), visible_moving.end());
+
+        REQUIRE(entities_of(registry.view<Position, Visible>()) == visible);
+        REQUIRE(entities_of(registry.view<Visible, Stunned>()) == visible_stunned);
+        REQUIRE(entities_of(registry.view<Position>(exclude<Dirty>)).size() == entities.size());
+        REQUIRE(entities_of(registry.view<Position, Visible>(exclude<Stunned>)) == visible_moving);
+        REQUIRE(entities_of(registry.view<Visible>(exclude<Stunned>)) == visible_moving);
+        REQUIRE(entities_of(std::as_const(registry).view<Visible>(exclude<Stunned>)) == visible_moving);
+        REQUIRE(registry.view<Visible, Dirty>().empty());
+
+        // a pool excluded from a view of tags alone
+        registry.remove<Position>(visible_moving.front());
+        auto without_position = entities_of(registry.view<Visible>(exclude<Stunned, Position>));
+        REQUIRE(without_position == std::vector<entity>{visible_moving.front()});
+
+        size_t count = 0;
+        registry.view<Position, Stunned>().each([&count](entity, Position&, Stunned) { count++; });
+        REQUIRE(count == 100);
+    }
+
+    SECTION("memory") {
+        for (size_t i = 0; i < 10000; i++) {
+            auto created = registry.create();
+            if (i % 10 == 0) {
+                registry.emplace<Dirty>(created);
+            }
+        }
+        const auto usage = registry.storage<Dirty>().memory_usage();
+        REQUIRE(usage.sparse.used == (10000 + 63) / 64 * sizeof(uint64_t));
+        REQUIRE(usage.packed.used == 0);
+        REQUIRE(usage.payload.used == 0);
+
+        registry.clear();
+        REQUIRE(registry.storage<Dirty>().empty());
+    }
+}
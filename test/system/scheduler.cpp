@@ -0,0 +1,96 @@
+#include "wecs/wecs.hpp"
+#include "wecs/system/scheduler.hpp"
+
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+using namespace wecs;
+
+using Registry = BasicRegistry<entity, config::page_size>;
+using Scheduler = BasicScheduler<Registry>;
+
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Health {
+    int value;
+};
+
+TEST_CASE("scheduler") {
+    Registry registry;
+
+    SECTION("graph") {
+        Scheduler scheduler{registry, 2};
+        scheduler.add<Reads<Velocity>, Writes<Position>>([](auto&) {});  // 0
+        scheduler.add<Reads<Position>>([](auto&) {});                    // 1
+        scheduler.add<Reads<Position>>([](auto&) {});                    // 2
+        scheduler.add<Reads<>, Writes<Health>>([](auto&) {});            // 3
+        scheduler.add<Reads<Health>, Writes<Velocity>>([](auto&) {});    // 4
+        scheduler.add<Reads<Velocity>, Writes<Position>>([](auto&) {});  // 5
+        REQUIRE(scheduler.size() == 6);
+
+        REQUIRE(scheduler.successors(0) == std::vector<size_t>{1, 2, 4, 5});
+        REQUIRE(scheduler.successors(1) == std::vector<size_t>{5});
+        REQUIRE(scheduler.successors(2) == std::vector<size_t>{5});
+        REQUIRE(scheduler.successors(3) == std::vector<size_t>{4});
+        REQUIRE(scheduler.successors(4) == std::vector<size_t>{5});
+        REQUIRE(scheduler.successors(5).empty());
+    }
+
+    SECTION("run") {
+        for (int i = 0; i < 100; i++) {
+            auto entity = registry.create();
+            registry.emplace<Position>(entity, Position{0.0f, 0.0f});
+            registry.emplace<Velocity>(entity, Velocity{1.0f, 0.0f});
+            registry.emplace<Health>(entity, Health{10});
+        }
+
+        std::mutex mutex;
+        std::vector<int> order;
+        auto record = [&](int id) {
+            std::lock_guard lock{mutex};
+            order.push_back(id);
+        };
+
+        Scheduler scheduler{registry, 4};
+        scheduler.add<Reads<>, Writes<Velocity>>([&](Registry& reg) {
+            for (auto&& [entity, vel] : reg.view<Velocity>()) {
+                vel.x = 2.0f;
+            }
+            record(0);
+        });
+        scheduler.add<Reads<Velocity>, Writes<Position>>([&](Registry& reg) {
+            for (auto&& [entity, pos, vel] : reg.view<Position, Velocity>()) {
+                pos.x += vel.x;
+            }
+            record(1);
+        });
+        scheduler.add<Reads<>, Writes<Health>>([&](Registry& reg) {
+            for (auto&& [entity, health] : reg.view<Health>()) {
+                health.value--;
+            }
+            record(2);
+        });
+        scheduler.add<Reads<Position, Health>>([&](Registry&) { record(3); });
+
+        for (int frame = 0; frame < 10; frame++) {
+            order.clear();
+            scheduler.run();
+            REQUIRE(order.size() == 4);
+            auto at = [&](int id) { return std::find(order.begin(), order.end(), id) - order.begin(); };
+            REQUIRE(at(0) < at(1));
+            REQUIRE(at(1) < at(3));
+            REQUIRE(at(2) < at(3));
+        }
+
+        for (auto&& [entity, pos, health] : registry.view<Position, Health>()) {
+            REQUIRE(pos.x == 20.0f);
+            REQUIRE(health.value == 0);
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "wecs/config/type_info.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <cassert>
 
@@ -10,10 +11,46 @@
 #define SPARSE_PAGE_SIZE 4096
 #endif
 
+#ifndef SPARSE_PAGE_ALIGNMENT
+#define SPARSE_PAGE_ALIGNMENT 64
+#endif
+
+#ifndef PAYLOAD_PAGE_SIZE
+#define PAYLOAD_PAGE_SIZE 1024
+#endif
+
+#ifndef ARCHETYPE_CHUNK_SIZE
+#define ARCHETYPE_CHUNK_SIZE 16384
+#endif
+
 #ifndef ENTITY_NUMERIC_TYPE
 #define ENTITY_NUMERIC_TYPE uint32_t
 #endif
 
+#ifdef WECS_ENABLE_STATS
+#define WECS_STATS(...) __VA_ARGS__
+#else
+#define WECS_STATS(...)
+#endif
+
+#if !defined(NDEBUG) && !defined(WECS_NO_ACCESS_CHECK)
+#define WECS_ACCESS_CHECK
+#endif
+
+#if defined(__AVX2__) && !defined(WECS_NO_SIMD)
+#define WECS_SIMD_AVX2
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define WECS_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define WECS_PREFETCH(address) ((void)(address))
+#endif
+
+#ifndef WECS_PREFETCH_DISTANCE
+#define WECS_PREFETCH_DISTANCE 8
+#endif
+
 #ifndef GET_TYPE_INFO
 #define GET_TYPE_INFO(type) get_type_info<type>()
 #endif
@@ -22,7 +59,13 @@ namespace wecs::config {
 
 enum class Entity : ENTITY_NUMERIC_TYPE {};
 constexpr uint32_t page_size = SPARSE_PAGE_SIZE;
+constexpr size_t sparse_page_alignment = SPARSE_PAGE_ALIGNMENT;
+constexpr size_t payload_page_size = PAYLOAD_PAGE_SIZE;
+constexpr size_t cache_line_size = 64u;
+constexpr size_t huge_page_size = 2u << 20u;
+constexpr size_t chunk_size = ARCHETYPE_CHUNK_SIZE;
 using type_info = const TypeInfo*;
 using id_type = uint32_t;
+using tick_type = uint32_t;
 
 } // namespace wecs::config
\ No newline at end of file
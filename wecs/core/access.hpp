@@ -0,0 +1,50 @@
+#pragma once
+
+#include "wecs/config/config.hpp"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace wecs {
+
+//! @brief tracks the thread writing to a pool, asserting when another one joins in
+//!
+//! Satisfies BasicLockable so it can be held with std::lock_guard. Writes nested
+//! on the owning thread, e.g. from signal listeners, are allowed.
+class AccessChecker {
+public:
+    AccessChecker() = default;
+
+    AccessChecker(const AccessChecker&) noexcept {}
+
+    AccessChecker& operator=(const AccessChecker&) noexcept {
+        return *this;
+    }
+
+    void lock() noexcept {
+        const auto self = std::this_thread::get_id();
+        auto expected = std::thread::id{};
+        if (!owner_.compare_exchange_strong(expected, self, std::memory_order_acquire)) {
+            WECS_ASSERT(expected == self, "concurrent write to the same pool");
+        }
+        depth_++;
+    }
+
+    void unlock() noexcept {
+        if (--depth_ == 0) {
+            owner_.store(std::thread::id{}, std::memory_order_release);
+        }
+    }
+
+private:
+    std::atomic<std::thread::id> owner_{};
+    size_t depth_{};
+};
+
+} // namespace wecs
+
+#ifdef WECS_ACCESS_CHECK
+#define WECS_ACCESS_GUARD(pool) std::lock_guard wecs_access_guard{(pool).access()}
+#else
+#define WECS_ACCESS_GUARD(pool)
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "wecs/config/config.hpp"
+#include <mutex>
 #include <unordered_map>
 
 namespace wecs {
@@ -11,10 +12,18 @@ struct Ident {
 
     inline static std::unordered_map<config::type_info, value_type> map;
     inline static value_type index{};
+    inline static std::mutex mutex;
 
+    //! @brief resolved once per type under a lock, lock-free afterwards
     template <typename Type>
     static value_type get() noexcept {
-        config::type_info type_info = GET_TYPE_INFO(Type);
+        static const value_type value = lookup(GET_TYPE_INFO(Type));
+        return value;
+    }
+
+private:
+    static value_type lookup(config::type_info type_info) {
+        std::lock_guard lock{mutex};
         if (auto it = map.find(type_info); it != map.end()) {
             return it->second;
         }
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "wecs/config/config.hpp"
+#include <cstddef>
+#include <new>
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace wecs {
+
+//! @brief allocate size bytes aligned to alignment
+//!
+//! Blocks aligned to config::huge_page_size are advised as transparent huge
+//! pages where the platform supports it.
+inline void* aligned_allocate(size_t size, size_t alignment) {
+    auto* ptr = ::operator new(size, std::align_val_t{alignment});
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (alignment >= config::huge_page_size) {
+        ::madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif
+    return ptr;
+}
+
+inline void aligned_deallocate(void* ptr, size_t alignment) noexcept {
+    ::operator delete(ptr, std::align_val_t{alignment});
+}
+
+//! @brief allocator handing out blocks aligned to Alignment bytes
+template <typename Type, size_t Alignment>
+struct AlignedAllocator {
+    static_assert(Alignment >= alignof(Type) && (Alignment & (Alignment - 1u)) == 0u, "invalid alignment");
+
+    using value_type = Type;
+
+    template <typename Other>
+    struct rebind {
+        using other = AlignedAllocator<Other, (Alignment < alignof(Other) ? alignof(Other) : Alignment)>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename Other, size_t OtherAlignment>
+    AlignedAllocator(const AlignedAllocator<Other, OtherAlignment>&) noexcept {}
+
+    Type* allocate(size_t count) {
+        return static_cast<Type*>(aligned_allocate(count * sizeof(Type), Alignment));
+    }
+
+    void deallocate(Type* ptr, size_t) noexcept {
+        aligned_deallocate(ptr, Alignment);
+    }
+
+    template <typename Other, size_t OtherAlignment>
+    bool operator==(const AlignedAllocator<Other, OtherAlignment>&) const noexcept {
+        return true;
+    }
+
+    template <typename Other, size_t OtherAlignment>
+    bool operator!=(const AlignedAllocator<Other, OtherAlignment>&) const noexcept {
+        return false;
+    }
+};
+
+} // namespace wecs
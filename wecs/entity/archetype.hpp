@@ -0,0 +1,442 @@
+#pragma once
+
+#include "wecs/core/ident.hpp"
+#include "wecs/entity/entity_pool.hpp"
+#include "wecs/config/config.hpp"
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+namespace wecs {
+
+namespace internal {
+
+//! @brief what an archetype needs to move and destroy a component it doesn't know the type of
+struct ComponentMeta {
+    config::id_type id;
+    size_t size;
+    size_t align;
+    void (*relocate)(void* dst, void* src);
+    void (*destroy)(void* value);
+
+    template <typename Type>
+    static ComponentMeta of(config::id_type id) noexcept {
+        return {id, sizeof(Type), alignof(Type),
+                [](void* dst, void* src) {
+                    auto* value = static_cast<Type*>(src);
+                    new (dst) Type{std::move(*value)};
+                    value->~Type();
+                },
+                [](void* value) { static_cast<Type*>(value)->~Type(); }};
+    }
+};
+
+//! @brief entities sharing one set of components, stored column by column in fixed size chunks
+//!
+//! Rows are kept packed: row i lives in chunk i / capacity(), so the last row is
+//! always the one moved into a hole left by a removal.
+template <typename EntityType, size_t ChunkSize>
+class Archetype {
+public:
+    using entity_type = EntityType;
+    static constexpr size_t chunk_align = 64;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    explicit Archetype(std::vector<ComponentMeta> components) : components_{std::move(components)} {
+        std::sort(components_.begin(), components_.end(), [](auto& lhs, auto& rhs) { return lhs.id < rhs.id; });
+        for (auto& meta : components_) {
+            WECS_ASSERT(meta.align <= chunk_align, "component is over aligned for a chunk");
+            signature_.push_back(meta.id);
+        }
+        size_t row_size = sizeof(entity_type);
+        for (auto& meta : components_) {
+            row_size += meta.size;
+        }
+        capacity_ = ChunkSize / row_size;
+        while (capacity_ > 0 && !layout(capacity_)) {
+            capacity_--;
+        }
+        WECS_ASSERT(capacity_ > 0, "components don't fit into a chunk");
+    }
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    ~Archetype() {
+        clear();
+        for (auto* chunk : chunks_) {
+            ::operator delete(chunk, std::align_val_t{chunk_align});
+        }
+    }
+
+    //! @brief append a row for entity, its components are left for the caller to construct
+    size_t allocate(entity_type entity) {
+        if (size_ == chunks_.size() * capacity_) {
+            chunks_.push_back(static_cast<std::byte*>(::operator new(ChunkSize, std::align_val_t{chunk_align})));
+        }
+        const auto row = size_++;
+        new (entities(row / capacity_) + row % capacity_) entity_type{entity};
+        return row;
+    }
+
+    //! @brief fill the hole at row with the last row, returning the entity now at row
+    //! @param destroy whether the components of row are still alive
+    entity_type erase(size_t row, bool destroy) {
+        const auto last = --size_;
+        if (destroy) {
+            for (size_t column = 0; column < components_.size(); column++) {
+                components_[column].destroy(at(column, row));
+            }
+        }
+        if (row != last) {
+            for (size_t column = 0; column < components_.size(); column++) {
+                components_[column].relocate(at(column, row), at(column, last));
+            }
+            entities(row / capacity_)[row % capacity_] = entities(last / capacity_)[last % capacity_];
+        }
+        return entities(row / capacity_)[row % capacity_];
+    }
+
+    void clear() noexcept {
+        for (size_t row = 0; row < size_; row++) {
+            for (size_t column = 0; column < components_.size(); column++) {
+                components_[column].destroy(at(column, row));
+            }
+        }
+        size_ = 0;
+    }
+
+    //! @brief the column of component id, npos if this archetype doesn't have it
+    size_t column(config::id_type id) const noexcept {
+        auto it = std::lower_bound(signature_.begin(), signature_.end(), id);
+        return it != signature_.end() && *it == id ? static_cast<size_t>(it - signature_.begin()) : npos;
+    }
+
+    void* at(size_t column, size_t row) noexcept {
+        return chunks_[row / capacity_] + offsets_[column] + (row % capacity_) * components_[column].size;
+    }
+
+    const void* at(size_t column, size_t row) const noexcept {
+        return chunks_[row / capacity_] + offsets_[column] + (row % capacity_) * components_[column].size;
+    }
+
+    entity_type* entities(size_t chunk) noexcept {
+        return reinterpret_cast<entity_type*>(chunks_[chunk]);
+    }
+
+    template <typename Type>
+    Type* data(size_t column, size_t chunk) noexcept {
+        return reinterpret_cast<Type*>(chunks_[chunk] + offsets_[column]);
+    }
+
+    //! @brief rows stored in chunk
+    size_t size(size_t chunk) const noexcept {
+        return std::min(capacity_, size_ - chunk * capacity_);
+    }
+
+public:
+    const auto& signature() const noexcept { return signature_; }
+    const auto& components() const noexcept { return components_; }
+
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_t capacity() const noexcept { return capacity_; }
+    size_t chunks() const noexcept { return (size_ + capacity_ - 1) / capacity_; }
+    size_t reserved() const noexcept { return chunks_.size() * ChunkSize; }
+
+    //! @brief archetypes reached by adding or removing one component, filled on first use
+    std::unordered_map<config::id_type, size_t> add_edges;
+    std::unordered_map<config::id_type, size_t> remove_edges;
+
+private:
+    bool layout(size_t capacity) {
+        offsets_.clear();
+        size_t offset = capacity * sizeof(entity_type);
+        for (auto& meta : components_) {
+            offset = (offset + meta.align - 1) / meta.align * meta.align;
+            offsets_.push_back(offset);
+            offset += capacity * meta.size;
+        }
+        return offset <= ChunkSize;
+    }
+
+private:
+    std::vector<ComponentMeta> components_;
+    std::vector<config::id_type> signature_;
+    std::vector<size_t> offsets_;
+    std::vector<std::byte*> chunks_;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+};
+
+} // namespace internal
+
+template <typename Registry, typename... Types>
+class ArchetypeView {
+public:
+    using entity_type = typename Registry::entity_type;
+    using archetype_type = typename Registry::archetype_type;
+
+    ArchetypeView(std::vector<archetype_type*> archetypes, std::array<config::id_type, sizeof...(Types)> ids)
+        : archetypes_{std::move(archetypes)}, ids_{ids} {}
+
+    //! @brief entities matched by the view, counted over its archetypes
+    size_t size() const noexcept {
+        size_t size = 0;
+        for (auto* archetype : archetypes_) {
+            size += archetype->size();
+        }
+        return size;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    //! @brief call func(entity, Types&...) for every entity, chunk by chunk
+    //!
+    //! Components must not be emplaced or removed from inside func.
+    template <typename Func>
+    void each(Func func) {
+        each_chunk([&func](size_t size, entity_type* entities, auto*... components) {
+            for (size_t i = 0; i < size; i++) {
+                func(entities[i], components[i]...);
+            }
+        });
+    }
+
+    //! @brief call func(size, entities, Types*...) once per chunk, with the columns of the chunk
+    template <typename Func>
+    void each_chunk(Func func) {
+        for (auto* archetype : archetypes_) {
+            std::array<size_t, sizeof...(Types)> columns;
+            for (size_t i = 0; i < sizeof...(Types); i++) {
+                columns[i] = archetype->column(ids_[i]);
+            }
+            for (size_t chunk = 0; chunk < archetype->chunks(); chunk++) {
+                call(func, *archetype, columns, chunk, std::index_sequence_for<Types...>{});
+            }
+        }
+    }
+
+    const auto& archetypes() const noexcept { return archetypes_; }
+
+private:
+    template <typename Func, size_t... Index>
+    static void call(Func& func, archetype_type& archetype, const std::array<size_t, sizeof...(Types)>& columns,
+                     size_t chunk, std::index_sequence<Index...>) {
+        func(archetype.size(chunk), archetype.entities(chunk), archetype.template data<Types>(columns[Index], chunk)...);
+    }
+
+private:
+    std::vector<archetype_type*> archetypes_;
+    std::array<config::id_type, sizeof...(Types)> ids_;
+};
+
+//! @brief registry keeping entities with the same components together in chunks
+//!
+//! An alternative to BasicRegistry for data iterated by whole component sets:
+//! views walk contiguous columns with no per component lookup, at the cost of
+//! moving an entity's components to another archetype whenever one is emplaced
+//! or removed. Components have no signals and don't track ticks.
+template <typename EntityType, size_t ChunkSize = config::chunk_size>
+class BasicArchetypeRegistry {
+public:
+    using entity_type = EntityType;
+    using traits_type = EntityTraits<EntityType>;
+    using archetype_type = internal::Archetype<EntityType, ChunkSize>;
+    using component_ident = Ident<struct ComponentIdent>;
+
+    template <typename... Types>
+    using view_type = ArchetypeView<BasicArchetypeRegistry, Types...>;
+
+    BasicArchetypeRegistry() {
+        archetypes_.push_back(std::make_unique<archetype_type>(std::vector<internal::ComponentMeta>{}));
+        index_.emplace(std::vector<config::id_type>{}, 0);
+    }
+
+    entity_type create() {
+        auto entity = entities_.emplace();
+        auto pos = traits_type::to_entity(entity);
+        if (pos >= locations_.size()) {
+            locations_.resize(pos + 1);
+        }
+        locations_[pos] = {0, archetypes_[0]->allocate(entity)};
+        return entity;
+    }
+
+    void destroy(entity_type entity) {
+        if (alive(entity)) {
+            auto& location = locations_[traits_type::to_entity(entity)];
+            erase(location, true);
+            entities_.remove(entity);
+        }
+    }
+
+    bool alive(entity_type entity) const {
+        return entities_.contain(entity);
+    }
+
+    void clear() {
+        for (auto& archetype : archetypes_) {
+            archetype->clear();
+        }
+        entities_.clear();
+    }
+
+    template <typename Type, typename... Args>
+    Type& emplace(entity_type entity, Args&&... args) {
+        WECS_ASSERT(alive(entity), "invalid entity");
+        WECS_ASSERT(!has<Type>(entity), "entity already has the component");
+        const auto id = assure<Type>();
+        auto& location = locations_[traits_type::to_entity(entity)];
+        migrate(entity, location, add_edge(location.archetype, id));
+        auto& archetype = *archetypes_[location.archetype];
+        return *(new (archetype.at(archetype.column(id), location.row)) Type{std::forward<Args>(args)...});
+    }
+
+    template <typename Type>
+    void remove(entity_type entity) {
+        if (has<Type>(entity)) {
+            const auto id = component_ident::get<Type>();
+            auto& location = locations_[traits_type::to_entity(entity)];
+            migrate(entity, location, remove_edge(location.archetype, id));
+        }
+    }
+
+    template <typename Type>
+    bool has(entity_type entity) const {
+        if (!alive(entity)) {
+            return false;
+        }
+        auto& location = locations_[traits_type::to_entity(entity)];
+        return archetypes_[location.archetype]->column(component_ident::get<Type>()) != archetype_type::npos;
+    }
+
+    template <typename Type>
+    Type& get(entity_type entity) {
+        WECS_ASSERT(has<Type>(entity), "entity doesn't have the component");
+        auto& location = locations_[traits_type::to_entity(entity)];
+        auto& archetype = *archetypes_[location.archetype];
+        return *static_cast<Type*>(archetype.at(archetype.column(component_ident::get<Type>()), location.row));
+    }
+
+    template <typename Type>
+    const Type& get(entity_type entity) const {
+        WECS_ASSERT(has<Type>(entity), "entity doesn't have the component");
+        auto& location = locations_[traits_type::to_entity(entity)];
+        const auto& archetype = *archetypes_[location.archetype];
+        return *static_cast<const Type*>(archetype.at(archetype.column(component_ident::get<Type>()), location.row));
+    }
+
+    //! @brief view over the archetypes having every one of Types
+    template <typename... Types>
+    view_type<Types...> view() {
+        static_assert(sizeof...(Types) > 0, "you must provide query component");
+        std::array<config::id_type, sizeof...(Types)> ids{component_ident::get<Types>()...};
+        std::vector<archetype_type*> matched;
+        for (auto& archetype : archetypes_) {
+            if (!archetype->empty() && std::all_of(ids.begin(), ids.end(), [&archetype](auto id) {
+                    return archetype->column(id) != archetype_type::npos;
+                })) {
+                matched.push_back(archetype.get());
+            }
+        }
+        return view_type<Types...>(std::move(matched), ids);
+    }
+
+public:
+    size_t size() const noexcept {
+        return entities_.size();
+    }
+
+    //! @brief archetypes created so far, including the empty one entities start in
+    const auto& archetypes() const noexcept { return archetypes_; }
+
+private:
+    struct Location {
+        size_t archetype;
+        size_t row;
+    };
+
+    template <typename Type>
+    config::id_type assure() {
+        const auto id = component_ident::get<Type>();
+        if (id >= metas_.size()) {
+            metas_.resize(id + 1);
+        }
+        if (!metas_[id].relocate) {
+            metas_[id] = internal::ComponentMeta::template of<Type>(id);
+        }
+        return id;
+    }
+
+    size_t add_edge(size_t from, config::id_type id) {
+        auto& edges = archetypes_[from]->add_edges;
+        if (auto it = edges.find(id); it != edges.end()) {
+            return it->second;
+        }
+        auto components = archetypes_[from]->components();
+        components.push_back(metas_[id]);
+        return edges[id] = find_or_create(std::move(components));
+    }
+
+    size_t remove_edge(size_t from, config::id_type id) {
+        auto& edges = archetypes_[from]->remove_edges;
+        if (auto it = edges.find(id); it != edges.end()) {
+            return it->second;
+        }
+        auto components = archetypes_[from]->components();
+        components.erase(std::find_if(components.begin(), components.end(), [id](auto& meta) { return meta.id == id; }));
+        return edges[id] = find_or_create(std::move(components));
+    }
+
+    size_t find_or_create(std::vector<internal::ComponentMeta> components) {
+        std::vector<config::id_type> signature;
+        for (auto& meta : components) {
+            signature.push_back(meta.id);
+        }
+        std::sort(signature.begin(), signature.end());
+        if (auto it = index_.find(signature); it != index_.end()) {
+            return it->second;
+        }
+        archetypes_.push_back(std::make_unique<archetype_type>(std::move(components)));
+        index_.emplace(std::move(signature), archetypes_.size() - 1);
+        return archetypes_.size() - 1;
+    }
+
+    // relocate the components both archetypes have, destroy the ones only the source has
+    void migrate(entity_type entity, Location& location, size_t to) {
+        auto& src = *archetypes_[location.archetype];
+        auto& dst = *archetypes_[to];
+        const auto row = dst.allocate(entity);
+        for (size_t column = 0; column < src.components().size(); column++) {
+            const auto& meta = src.components()[column];
+            if (auto target = dst.column(meta.id); target != archetype_type::npos) {
+                meta.relocate(dst.at(target, row), src.at(column, location.row));
+            } else {
+                meta.destroy(src.at(column, location.row));
+            }
+        }
+        erase(location, false);
+        location = {to, row};
+    }
+
+    void erase(const Location& location, bool destroy) {
+        const auto moved = archetypes_[location.archetype]->erase(location.row, destroy);
+        locations_[traits_type::to_entity(moved)].row = location.row;
+    }
+
+private:
+    std::vector<std::unique_ptr<archetype_type>> archetypes_;
+    std::map<std::vector<config::id_type>, size_t> index_;
+    std::vector<internal::ComponentMeta> metas_;
+    std::vector<Location> locations_;
+    BasicEntityPool<EntityType> entities_;
+};
+
+} // namespace wecs
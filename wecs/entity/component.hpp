@@ -1,5 +1,7 @@
 #pragma once
 
+#include "wecs/config/config.hpp"
+#include <tuple>
 #include <type_traits>
 
 namespace wecs {
@@ -7,7 +9,7 @@ namespace wecs {
 namespace internal {
 
 template <typename Type, typename = void>
-struct PageSize : std::integral_constant<size_t, !std::is_empty_v<Type>> {};
+struct PageSize : std::integral_constant<size_t, std::is_empty_v<Type> ? 0u : config::payload_page_size> {};
 
 template <>
 struct PageSize<void> : std::integral_constant<size_t, 0u> {};
@@ -16,6 +18,40 @@ template <typename Type>
 struct PageSize<Type, std::void_t<decltype(Type::page_size)>>
     : std::integral_constant<size_t, Type::page_size> {};
 
+template <typename Type, typename = void>
+struct PageAlignment : std::integral_constant<size_t, alignof(Type)> {};
+
+template <>
+struct PageAlignment<void> : std::integral_constant<size_t, 1u> {};
+
+template <typename Type>
+struct PageAlignment<Type, std::void_t<decltype(Type::page_alignment)>>
+    : std::integral_constant<size_t, Type::page_alignment> {};
+
+template <typename Type, typename = void>
+struct Signal : std::true_type {};
+
+template <typename Type>
+struct Signal<Type, std::void_t<decltype(Type::signal)>>
+    : std::bool_constant<Type::signal> {};
+
+template <typename Type, typename = void>
+struct TrackTicks : std::false_type {};
+
+template <typename Type>
+struct TrackTicks<Type, std::void_t<decltype(Type::track_ticks)>>
+    : std::bool_constant<Type::track_ticks> {};
+
+template <typename Type, typename = void>
+struct Fields {
+    static constexpr std::tuple<> value{};
+};
+
+template <typename Type>
+struct Fields<Type, std::void_t<decltype(Type::fields)>> {
+    static constexpr auto value = Type::fields;
+};
+
 } // namespace internal
 
 template <typename Type, typename = void>
@@ -25,6 +61,20 @@ struct ComponentTraits {
     using type = Type;
 
     static constexpr size_t page_size = internal::PageSize<type>::value;
+
+    //! @brief alignment of every payload page, e.g. config::cache_line_size or
+    //! config::huge_page_size along with a page_size filling the huge page
+    static constexpr size_t page_alignment = internal::PageAlignment<type>::value;
+
+    //! @brief whether the registry wraps the storage with SighMixin
+    static constexpr bool signal = internal::Signal<type>::value;
+
+    //! @brief whether the registry records added/changed ticks with TickMixin
+    static constexpr bool track_ticks = internal::TrackTicks<type>::value;
+
+    //! @brief member pointers to every field, e.g. std::make_tuple(&Type::x, &Type::y)
+    //! declared after the members, to have the registry store each field in its own array
+    static constexpr auto fields = internal::Fields<type>::value;
 };
 
 } // namespace wecs
\ No newline at end of file
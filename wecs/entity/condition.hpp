@@ -0,0 +1,110 @@
+#pragma once
+
+#include "wecs/entity/component.hpp"
+#include <vector>
+
+namespace wecs {
+
+//! @brief compound presence test over pools resolved once, for rules evaluated per entity
+//!
+//! Built as registry.condition().all_of<Position, Velocity>().any_of<Player, Enemy>().none_of<Frozen>():
+//! every all_of type, one type of each any_of group and no none_of type. The pools are
+//! created when the condition is built, so testing an entity is a sparse probe per pool.
+template <typename Registry>
+class BasicCondition {
+public:
+    using registry_type = Registry;
+    using entity_type = typename registry_type::entity_type;
+    using base_type = typename registry_type::base_type;
+    using tag_set_type = typename registry_type::tag_set_type;
+
+    explicit BasicCondition(registry_type& registry) : registry_{&registry} {}
+
+    template <typename... Types>
+    BasicCondition& all_of() {
+        (add<Types>(all_), ...);
+        return *this;
+    }
+
+    //! @brief one more group of which at least one type is required
+    template <typename... Types>
+    BasicCondition& any_of() {
+        auto& group = any_.emplace_back();
+        (add<Types>(group), ...);
+        return *this;
+    }
+
+    template <typename... Types>
+    BasicCondition& none_of() {
+        (add<Types>(none_), ...);
+        return *this;
+    }
+
+    bool operator()(entity_type entity) const {
+        // bits don't know versions, so stale handles are ruled out once for every tag
+        const bool alive = !tagged_ || registry_->alive(entity);
+        if (!all(all_, entity, alive)) {
+            return false;
+        }
+        for (auto& group : any_) {
+            if (!any(group, entity, alive)) {
+                return false;
+            }
+        }
+        return !any(none_, entity, alive);
+    }
+
+private:
+    struct Group {
+        std::vector<const base_type*> pools;
+        std::vector<const tag_set_type*> tags;
+    };
+
+    template <typename Type>
+    void add(Group& group) {
+        const auto& pool = registry_->template storage<Type>();
+        if constexpr (ComponentTraits<Type>::page_size == 0u) {
+            group.tags.push_back(&pool);
+            tagged_ = true;
+        } else {
+            group.pools.push_back(&pool);
+        }
+    }
+
+    static bool all(const Group& group, entity_type entity, bool alive) {
+        for (const auto* pool : group.pools) {
+            if (!pool->contain(entity)) {
+                return false;
+            }
+        }
+        for (const auto* tags : group.tags) {
+            if (!alive || !tags->contain(entity)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool any(const Group& group, entity_type entity, bool alive) {
+        for (const auto* pool : group.pools) {
+            if (pool->contain(entity)) {
+                return true;
+            }
+        }
+        for (const auto* tags : group.tags) {
+            if (alive && tags->contain(entity)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    registry_type* registry_;
+    Group all_;
+    std::vector<Group> any_;
+    Group none_;
+    bool tagged_ = false;
+};
+
+} // namespace wecs
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "wecs/entity/entity.hpp"
+#include "wecs/entity/stats.hpp"
+#include "wecs/core/access.hpp"
+#include "wecs/config/config.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace wecs {
+
+namespace internal {
+
+template <typename Pool>
+struct EntityPoolIterator {
+    using container_type = typename Pool::container_type;
+    using entity_type = typename Pool::entity_type;
+    using traits_type = typename Pool::traits_type;
+    using difference_type = std::ptrdiff_t;
+    using value_type = entity_type;
+    using pointer = const entity_type*;
+    using reference = entity_type;
+    using iterator_category = std::forward_iterator_tag;
+
+    EntityPoolIterator() : entities_{}, pos_{} {}
+
+    EntityPoolIterator(const container_type& entities, size_t pos)
+        : entities_{&entities}, pos_{pos} {
+        skip();
+    }
+
+    EntityPoolIterator& operator++() {
+        return ++pos_, skip(), *this;
+    }
+
+    EntityPoolIterator operator++(int) {
+        EntityPoolIterator copy = *this;
+        return ++(*this), copy;
+    }
+
+    reference operator*() const {
+        return static_cast<entity_type>((*entities_)[pos_]);
+    }
+
+    bool operator==(const EntityPoolIterator& other) const {
+        return pos_ == other.pos_;
+    }
+
+    bool operator!=(const EntityPoolIterator& other) const {
+        return !(*this == other);
+    }
+
+private:
+    void skip() {
+        while (pos_ < entities_->size() && traits_type::to_entity(operator*()) != pos_) {
+            ++pos_;
+        }
+    }
+
+private:
+    const container_type* entities_;
+    size_t pos_;
+};
+
+} // namespace internal
+
+//! @brief entity allocator recycling through a free list threaded through its slots
+//!
+//! A live slot holds its own entity, a free slot holds the index of the next free
+//! slot combined with the version the slot is recycled with. Creating or
+//! destroying an entity touches a single slot and never reorders the others.
+template <typename EntityType>
+class BasicEntityPool {
+public:
+    using entity_type = EntityType;
+    using traits_type = EntityTraits<EntityType>;
+    using container_type = std::vector<typename traits_type::entity_type>;
+    using iterator = internal::EntityPoolIterator<BasicEntityPool>;
+
+    auto emplace() {
+        size_++;
+        WECS_STATS(stats_.emplace++);
+        WECS_STATS(stats_.peak_size = std::max(stats_.peak_size, size_));
+        if (free_list_ == null) {
+            const auto entity = traits_type::construct(static_cast<typename traits_type::entity_type>(entities_.size()), 0);
+            entities_.push_back(traits_type::to_integral(entity));
+            return entity;
+        }
+        const auto pos = free_list_;
+        const auto slot = static_cast<EntityType>(entities_[pos]);
+        free_list_ = traits_type::to_entity(slot);
+        const auto entity = traits_type::construct(pos, traits_type::to_version(slot));
+        entities_[pos] = traits_type::to_integral(entity);
+        return entity;
+    }
+
+    void remove(EntityType value) {
+        WECS_ASSERT(contain(value), "entity not found");
+        const auto pos = traits_type::to_entity(value);
+        const auto version = traits_type::to_version(traits_type::next(value));
+        entities_[pos] = traits_type::to_integral(traits_type::construct(free_list_, version));
+        free_list_ = pos;
+        size_--;
+        WECS_STATS(stats_.remove++);
+    }
+
+    bool contain(EntityType value) const {
+        const auto pos = traits_type::to_entity(value);
+        return pos < entities_.size() && entities_[pos] == traits_type::to_integral(value);
+    }
+
+public:
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    auto size() const noexcept {
+        return size_;
+    }
+
+    //! @brief number of slots, live or free
+    auto base_size() const noexcept {
+        return entities_.size();
+    }
+
+    //! @brief the live entity with index entity
+    EntityType current(typename traits_type::entity_type entity) const {
+        WECS_ASSERT(contain(static_cast<EntityType>(entities_[entity])), "no live entity with this index");
+        return static_cast<EntityType>(entities_[entity]);
+    }
+
+    void reserve(size_t capacity) {
+        entities_.reserve(capacity);
+    }
+
+    void clear() noexcept {
+        entities_.clear();
+        free_list_ = null;
+        size_ = 0;
+    }
+
+    iterator begin() const noexcept {
+        return {entities_, 0};
+    }
+
+    iterator end() const noexcept {
+        return {entities_, entities_.size()};
+    }
+
+    template <typename Func>
+    void each(Func func) const {
+        for (auto entity : *this) {
+            func(entity);
+        }
+    }
+
+    MemoryUsage memory_usage() const noexcept {
+        using value_type = typename container_type::value_type;
+        MemoryUsage usage;
+        usage.packed = {entities_.capacity() * sizeof(value_type), entities_.size() * sizeof(value_type)};
+        return usage;
+    }
+
+    void shrink_to_fit() {
+        entities_.shrink_to_fit();
+    }
+
+#ifdef WECS_ACCESS_CHECK
+    //! @brief held by the registry around writes to this pool
+    AccessChecker& access() const noexcept { return access_; }
+#endif
+
+#ifdef WECS_ENABLE_STATS
+    PoolStats stats() const noexcept {
+        PoolStats stats = stats_;
+        stats.size = size_;
+        return stats;
+    }
+#endif
+
+private:
+    static constexpr auto null = traits_type::entity_mask;
+
+    container_type entities_;
+    typename traits_type::entity_type free_list_ = null;
+    size_t size_ = 0;
+    WECS_STATS(PoolStats stats_;)
+#ifdef WECS_ACCESS_CHECK
+    mutable AccessChecker access_;
+#endif
+};
+
+} // namespace wecs
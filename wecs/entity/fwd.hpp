@@ -1,9 +1,24 @@
 #pragma once
 
 #include "wecs/entity/registry.hpp"
+#include "wecs/entity/observer.hpp"
+#include "wecs/entity/runtime_view.hpp"
+#include "wecs/entity/archetype.hpp"
+#include "wecs/entity/hierarchy.hpp"
+#include "wecs/entity/spatial_hash.hpp"
 
 namespace wecs {
 
 using registry = BasicRegistry<config::Entity, config::page_size>;
+using observer = BasicObserver<config::Entity, config::page_size>;
+using condition = BasicCondition<registry>;
+template <typename... Types>
+using query = registry::query_type<Types...>;
+using runtime_view = BasicRuntimeView<config::Entity, config::page_size>;
+using archetype_registry = BasicArchetypeRegistry<config::Entity>;
+using relationship = BasicRelationship<config::Entity>;
+using hierarchy = BasicHierarchy<config::Entity, config::page_size>;
+template <auto X, auto Y>
+using spatial_hash = BasicSpatialHash<config::Entity, config::page_size, X, Y>;
 
 } // namespace wecs
\ No newline at end of file
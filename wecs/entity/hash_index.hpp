@@ -0,0 +1,208 @@
+#pragma once
+
+#include "wecs/entity/storage.hpp"
+#include "wecs/entity/entity.hpp"
+#include <functional>
+
+namespace wecs {
+
+namespace internal {
+
+//! @brief what the registry needs of the indices it owns
+class IndexBase {
+public:
+    virtual ~IndexBase() = default;
+
+    //! @brief forget every entity, for pools cleared without signals
+    virtual void clear() = 0;
+};
+
+} // namespace internal
+
+//! @brief hash index from a member of the components in a SighMixin pool to their entities
+//!
+//! Entries live in one open addressing table with linear probing, removed by
+//! shifting the rest of their cluster back, so there are no tombstones and a
+//! lookup never reads past the first empty slot. The key each entity was
+//! indexed under is kept aside, so that patches can find and move the old entry.
+//! Only emplace, patch, replace and remove are seen; call refresh() after
+//! writing through get_mutable or a view.
+//! @tparam Unique whether keys must be held by at most one entity
+template <typename Storage, typename Key, bool Unique>
+class BasicHashIndex final : public internal::IndexBase {
+public:
+    using storage_type = Storage;
+    using entity_type = typename storage_type::entity_type;
+    using payload_type = typename storage_type::payload_type;
+    using key_type = Key;
+    using member_type = Key payload_type::*;
+
+    static constexpr size_t sparse_page_size = std::tuple_size_v<typename storage_type::base_type::page_type>;
+
+    BasicHashIndex(storage_type& pool, member_type member)
+        : pool_{&pool}, member_{member} {
+        pool_->on_construct().template connect<&BasicHashIndex::insert>(*this);
+        pool_->on_update().template connect<&BasicHashIndex::update>(*this);
+        pool_->on_destruction().template connect<&BasicHashIndex::erase>(*this);
+        rebuild();
+    }
+
+    ~BasicHashIndex() override {
+        pool_->on_construct().disconnect(this);
+        pool_->on_update().disconnect(this);
+        pool_->on_destruction().disconnect(this);
+    }
+
+    BasicHashIndex(const BasicHashIndex&) = delete;
+    BasicHashIndex& operator=(const BasicHashIndex&) = delete;
+
+    //! @brief an entity holding key, empty_entity if there is none
+    entity_type find(const key_type& key) const {
+        if (size_ != 0u) {
+            for (auto pos = home(key); slots_[pos].entity != empty_entity; pos = (pos + 1u) & mask()) {
+                if (slots_[pos].key == key) {
+                    return slots_[pos].entity;
+                }
+            }
+        }
+        return entity_type{empty_entity};
+    }
+
+    //! @brief call func(entity) for every entity holding key
+    template <typename Func>
+    void each(const key_type& key, Func func) const {
+        if (size_ == 0u) {
+            return;
+        }
+        for (auto pos = home(key); slots_[pos].entity != empty_entity; pos = (pos + 1u) & mask()) {
+            if (slots_[pos].key == key) {
+                func(slots_[pos].entity);
+            }
+        }
+    }
+
+    size_t count(const key_type& key) const {
+        size_t result = 0;
+        each(key, [&result](auto) { result++; });
+        return result;
+    }
+
+    bool contain(const key_type& key) const {
+        return find(key) != empty_entity;
+    }
+
+    //! @brief re-read the key of entity, after writes the signals didn't see
+    void refresh(entity_type entity) {
+        update(entity, (*pool_)[entity]);
+    }
+
+    //! @brief index every entity of the pool from scratch
+    void rebuild() {
+        clear();
+        for (auto value : pool_->packed()) {
+            insert(static_cast<entity_type>(value), (*pool_)[static_cast<entity_type>(value)]);
+        }
+    }
+
+    void clear() override {
+        slots_.clear();
+        keys_.clear();
+        size_ = 0;
+    }
+
+public:
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    size_t capacity() const noexcept {
+        return slots_.size();
+    }
+
+    member_type member() const noexcept {
+        return member_;
+    }
+
+private:
+    struct Slot {
+        key_type key{};
+        entity_type entity = empty_entity;
+    };
+
+    size_t mask() const noexcept {
+        return slots_.size() - 1u;
+    }
+
+    // Fibonacci hashing spreads the identity hashes of integers over the table
+    size_t home(const key_type& key) const noexcept {
+        return static_cast<size_t>((static_cast<uint64_t>(std::hash<key_type>{}(key)) * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+
+    void insert(entity_type entity, const payload_type& payload) {
+        const auto& key = payload.*member_;
+        WECS_ASSERT(!Unique || !contain(key), "key already indexed");
+        if ((size_ + 1u) * 2u > slots_.size()) {
+            grow();
+        }
+        place(Slot{key, entity});
+        keys_.emplace(entity, key);
+        size_++;
+    }
+
+    void update(entity_type entity, const payload_type& payload) {
+        if (!(keys_[entity] == payload.*member_)) {
+            erase(entity, payload);
+            insert(entity, payload);
+        }
+    }
+
+    // backward shift: pull later entries of the cluster into the hole unless
+    // their home lies cyclically within (hole, entry]
+    void erase(entity_type entity, const payload_type&) {
+        auto hole = home(keys_[entity]);
+        while (slots_[hole].entity != entity) {
+            hole = (hole + 1u) & mask();
+        }
+        for (auto pos = (hole + 1u) & mask(); slots_[pos].entity != empty_entity; pos = (pos + 1u) & mask()) {
+            const auto ideal = home(slots_[pos].key);
+            if (((pos - ideal) & mask()) >= ((pos - hole) & mask())) {
+                slots_[hole] = std::move(slots_[pos]);
+                hole = pos;
+            }
+        }
+        slots_[hole] = Slot{};
+        keys_.remove(entity);
+        size_--;
+    }
+
+    void place(Slot&& slot) {
+        auto pos = home(slot.key);
+        while (slots_[pos].entity != empty_entity) {
+            pos = (pos + 1u) & mask();
+        }
+        slots_[pos] = std::move(slot);
+    }
+
+    void grow() {
+        auto old = std::exchange(slots_, std::vector<Slot>(std::max<size_t>(16u, slots_.size() * 2u)));
+        shift_ = 64u;
+        for (auto size = slots_.size(); size > 1u; size >>= 1u) {
+            shift_--;
+        }
+        for (auto& slot : old) {
+            if (slot.entity != empty_entity) {
+                place(std::move(slot));
+            }
+        }
+    }
+
+private:
+    storage_type* pool_;
+    member_type member_;
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+    unsigned shift_ = 64u;
+    BasicStorage<entity_type, key_type, sparse_page_size, std::allocator<key_type>> keys_;
+};
+
+} // namespace wecs
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "wecs/entity/registry.hpp"
+
+namespace wecs {
+
+//! @brief links of an entity in a hierarchy, empty_entity where there is none
+template <typename EntityType>
+struct BasicRelationship {
+    EntityType parent = empty_entity;
+    EntityType first_child = empty_entity;
+    EntityType prev_sibling = empty_entity;
+    EntityType next_sibling = empty_entity;
+};
+
+//! @brief parent/child links kept as BasicRelationship components of a registry
+//!
+//! The relationship pool is kept ordered so that every parent is packed before
+//! its children. Propagating values from parents to children, e.g. world
+//! transforms, is then a single forward pass with each(). Reordering is done
+//! incrementally by swapping elements out of order, on attach and after
+//! destructions, never by sorting the whole pool.
+template <typename EntityType, size_t PageSize,
+          typename EntityStorage = SighMixin<BasicStorage<EntityType, EntityType, PageSize, void>>>
+class BasicHierarchy {
+public:
+    using registry_type = BasicRegistry<EntityType, PageSize, EntityStorage>;
+    using entity_type = EntityType;
+    using relationship_type = BasicRelationship<EntityType>;
+    using storage_type = typename registry_type::template storage_for_t<relationship_type>;
+
+    BasicHierarchy(registry_type& registry)
+        : registry_{&registry}, pool_{&registry.template storage<relationship_type>()} {
+        registry_->template on_destruction<relationship_type>().template connect<&BasicHierarchy::unlink>(*this);
+    }
+
+    ~BasicHierarchy() {
+        registry_->template on_destruction<relationship_type>().disconnect(this);
+    }
+
+    BasicHierarchy(const BasicHierarchy&) = delete;
+    BasicHierarchy& operator=(const BasicHierarchy&) = delete;
+
+    //! @brief make child the first child of parent, detaching it from its former parent
+    void attach(entity_type child, entity_type parent) {
+        WECS_ASSERT(child != parent && !is_ancestor(child, parent), "attaching would create a cycle");
+        assure(child);
+        assure(parent);
+        detach(child);
+        auto& node = (*pool_)[child];
+        auto& parent_node = (*pool_)[parent];
+        node.parent = parent;
+        node.next_sibling = parent_node.first_child;
+        if (parent_node.first_child != empty_entity) {
+            (*pool_)[parent_node.first_child].prev_sibling = child;
+        }
+        parent_node.first_child = child;
+        pending_.push_back(child);
+        repair();
+    }
+
+    //! @brief make entity a root, keeping its own children
+    void detach(entity_type entity) {
+        if (!pool_->contain(entity)) {
+            return;
+        }
+        auto& node = (*pool_)[entity];
+        if (node.prev_sibling != empty_entity) {
+            (*pool_)[node.prev_sibling].next_sibling = node.next_sibling;
+        } else if (node.parent != empty_entity) {
+            (*pool_)[node.parent].first_child = node.next_sibling;
+        }
+        if (node.next_sibling != empty_entity) {
+            (*pool_)[node.next_sibling].prev_sibling = node.prev_sibling;
+        }
+        node.parent = node.prev_sibling = node.next_sibling = empty_entity;
+    }
+
+    //! @brief whether ancestor is entity itself or one of its ancestors
+    bool is_ancestor(entity_type ancestor, entity_type entity) const {
+        for (; entity != ancestor; entity = (*pool_)[entity].parent) {
+            if (!pool_->contain(entity)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    entity_type parent(entity_type entity) const {
+        return pool_->contain(entity) ? (*pool_)[entity].parent : entity_type{empty_entity};
+    }
+
+    //! @brief call func(child) for every child of entity, most recently attached first
+    template <typename Func>
+    void each_child(entity_type entity, Func func) const {
+        if (!pool_->contain(entity)) {
+            return;
+        }
+        for (auto child = (*pool_)[entity].first_child; child != empty_entity; child = (*pool_)[child].next_sibling) {
+            func(child);
+        }
+    }
+
+    //! @brief call func(entity, relationship) for every node, each parent before its children
+    template <typename Func>
+    void each(Func func) {
+        repair();
+        pool_->each(func);
+    }
+
+public:
+    size_t size() const noexcept {
+        return pool_->size();
+    }
+
+    bool contain(entity_type entity) const {
+        return pool_->contain(entity);
+    }
+
+    const relationship_type& relationship(entity_type entity) const {
+        return (*pool_)[entity];
+    }
+
+private:
+    void assure(entity_type entity) {
+        if (!pool_->contain(entity)) {
+            registry_->template emplace<relationship_type>(entity);
+        }
+    }
+
+    // children become roots; the last element is moved into the hole once the listener returns
+    void unlink(entity_type entity, relationship_type& node) {
+        for (auto child = node.first_child; child != empty_entity;) {
+            auto& child_node = (*pool_)[child];
+            child = std::exchange(child_node.next_sibling, empty_entity);
+            child_node.parent = child_node.prev_sibling = empty_entity;
+        }
+        node.first_child = empty_entity;
+        detach(entity);
+        const auto last = static_cast<entity_type>(pool_->packed().back());
+        if (last != entity) {
+            pending_.push_back(last);
+        }
+    }
+
+    // Swap parent/child pairs found out of order until none is left. Every swap
+    // moves a node behind one of its children, so the sum of depth times position
+    // over all nodes grows and the loop ends.
+    void repair() {
+        while (!pending_.empty()) {
+            const auto entity = pending_.back();
+            pending_.pop_back();
+            if (!pool_->contain(entity)) {
+                continue;
+            }
+            const auto pos = pool_->index(entity);
+            const auto& node = (*pool_)[entity];
+            if (node.parent != empty_entity && pool_->index(node.parent) > pos) {
+                reorder(node.parent, entity);
+                continue;
+            }
+            for (auto child = node.first_child; child != empty_entity; child = (*pool_)[child].next_sibling) {
+                if (pool_->index(child) < pos) {
+                    reorder(entity, child);
+                    break;
+                }
+            }
+        }
+    }
+
+    void reorder(entity_type parent, entity_type child) {
+        pool_->swap_elements(parent, child);
+        pending_.push_back(parent);
+        pending_.push_back(child);
+    }
+
+private:
+    registry_type* registry_;
+    storage_type* pool_;
+    std::vector<entity_type> pending_;
+};
+
+} // namespace wecs
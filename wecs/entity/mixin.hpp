@@ -3,44 +3,162 @@
 #include "wecs/signal/sigh.hpp"
 #include "wecs/signal/sink.hpp"
 #include "wecs/entity/storage.hpp"
+#include "wecs/entity/soa_storage.hpp"
+#include "wecs/entity/entity_pool.hpp"
 
 namespace wecs {
 
-// Type: BasicStorage
+namespace internal {
+
+template <typename Sigh>
+MemoryUsage::Part signal_usage(const Sigh& sigh) noexcept {
+    using delegate_type = typename Sigh::delegate_type;
+    return {sigh.capacity() * sizeof(delegate_type), sigh.size() * sizeof(delegate_type)};
+}
+
+} // namespace internal
+
+// Type: BasicStorage or BasicSoaStorage
+template <typename Type>
+class TickMixin : public Type {
+public:
+    using underlying_type = Type;
+    using entity_type = typename underlying_type::entity_type;
+    using payload_type = typename underlying_type::payload_type;
+    using tick_type = config::tick_type;
+    using tick_container_type = std::vector<tick_type>;
+
+    //! @brief stamp every following write with the value behind clock
+    void bind(const tick_type* clock) noexcept {
+        clock_ = clock;
+    }
+
+    template <typename... Args>
+    decltype(auto) emplace(entity_type entity, Args&&... args) {
+        decltype(auto) payload = underlying_type::emplace(entity, std::forward<Args>(args)...);
+        added_.push_back(now());
+        changed_.push_back(now());
+        return payload;
+    }
+
+    template <typename... Func>
+    decltype(auto) patch(entity_type entity, Func&&... func) {
+        decltype(auto) payload = underlying_type::patch(entity, std::forward<Func>(func)...);
+        changed_[underlying_type::index(entity)] = now();
+        return payload;
+    }
+
+    void remove(entity_type entity) override {
+        const auto pos = underlying_type::index(entity);
+        added_[pos] = added_.back();
+        added_.pop_back();
+        changed_[pos] = changed_.back();
+        changed_.pop_back();
+        underlying_type::remove(entity);
+    }
+
+    void swap_elements(entity_type lhs, entity_type rhs) override {
+        std::swap(added_[underlying_type::index(lhs)], added_[underlying_type::index(rhs)]);
+        std::swap(changed_[underlying_type::index(lhs)], changed_[underlying_type::index(rhs)]);
+        underlying_type::swap_elements(lhs, rhs);
+    }
+
+    void clear() noexcept override {
+        underlying_type::clear();
+        added_.clear();
+        changed_.clear();
+    }
+
+    MemoryUsage memory_usage() const noexcept override {
+        auto usage = underlying_type::memory_usage();
+        usage.packed += {(added_.capacity() + changed_.capacity()) * sizeof(tick_type),
+                         (added_.size() + changed_.size()) * sizeof(tick_type)};
+        return usage;
+    }
+
+    void shrink_to_fit() override {
+        underlying_type::shrink_to_fit();
+        added_.shrink_to_fit();
+        changed_.shrink_to_fit();
+    }
+
+    //! @brief mark the component of entity as changed without touching it
+    void touch(entity_type entity) {
+        WECS_ASSERT(underlying_type::contain(entity), "entity not found");
+        changed_[underlying_type::index(entity)] = now();
+    }
+
+public:
+    tick_type added(entity_type entity) const {
+        return added_[underlying_type::index(entity)];
+    }
+
+    tick_type changed(entity_type entity) const {
+        return changed_[underlying_type::index(entity)];
+    }
+
+    const auto& added_ticks() const noexcept { return added_; }
+    const auto& changed_ticks() const noexcept { return changed_; }
+
+private:
+    tick_type now() const noexcept {
+        return clock_ ? *clock_ : tick_type{};
+    }
+
+private:
+    const tick_type* clock_ = nullptr;
+    tick_container_type added_;
+    tick_container_type changed_;
+};
+
+// Type: BasicStorage, BasicSoaStorage or TickMixin
 template <typename Type>
 class SighMixin final : public Type {
 public:
     using underlying_type = Type;
     using entity_type = typename underlying_type::entity_type;
     using payload_type = typename underlying_type::payload_type;
-    using sigh_type = Sigh<void(entity_type, payload_type&)>;
+    using sigh_type = Sigh<void(entity_type, typename underlying_type::reference)>;
 
     SighMixin() : underlying_type{} {}
 
     template <typename... Args>
-    auto& emplace(entity_type entity, Args&&... args) {
-        auto& payload = underlying_type::emplace(entity, std::forward<Args>(args)...);
-        construction_.trigger(entity, payload);
+    decltype(auto) emplace(entity_type entity, Args&&... args) {
+        decltype(auto) payload = underlying_type::emplace(entity, std::forward<Args>(args)...);
+        if (!construction_.empty()) {
+            construction_.trigger(entity, payload);
+        }
         return payload;
     }
 
     template <typename... Func>
-    auto& patch(entity_type entity, Func&&... func) {
-        auto& payload = underlying_type::patch(entity, std::forward<Func>(func)...);
-        update_.trigger(entity, payload);
+    decltype(auto) patch(entity_type entity, Func&&... func) {
+        decltype(auto) payload = underlying_type::patch(entity, std::forward<Func>(func)...);
+        if (!update_.empty()) {
+            update_.trigger(entity, payload);
+        }
         return payload;
     }
 
-    void remove(entity_type entity) {
-        auto& payload = underlying_type::operator[](entity);
-        destruction_.trigger(entity, payload);
+    void remove(entity_type entity) override {
+        if (!destruction_.empty()) {
+            destruction_.trigger(entity, underlying_type::operator[](entity));
+        }
         underlying_type::remove(entity);
     }
 
-    void clear() {
+    void clear() noexcept override {
         underlying_type::clear();
     }
 
+    MemoryUsage memory_usage() const noexcept override {
+        auto usage = underlying_type::memory_usage();
+        usage.signals += internal::signal_usage(construction_);
+        usage.signals += internal::signal_usage(update_);
+        usage.signals += internal::signal_usage(destruction_);
+        return usage;
+    }
+
 public:
     auto on_construct() noexcept {
         return Sink{construction_};
@@ -54,6 +172,13 @@ public:
         return Sink{destruction_};
     }
 
+    //! @brief disconnect every listener, e.g. from a copy that shouldn't notify them
+    void clear_listeners() noexcept {
+        construction_.clear();
+        update_.clear();
+        destruction_.clear();
+    }
+
 private:
     sigh_type construction_;
     sigh_type destruction_;
@@ -70,19 +195,30 @@ public:
 
     auto emplace() {
         auto entity = underlying_type::emplace();
-        construction_.trigger(entity);
+        if (!construction_.empty()) {
+            construction_.trigger(entity);
+        }
         return entity;
     }
 
-    void remove(entity_type entity) {
-        destruction_.trigger(entity);
+    void remove(entity_type entity) override {
+        if (!destruction_.empty()) {
+            destruction_.trigger(entity);
+        }
         underlying_type::remove(entity);
     }
 
-    void clear() {
+    void clear() noexcept override {
         underlying_type::clear();
     }
 
+    MemoryUsage memory_usage() const noexcept override {
+        auto usage = underlying_type::memory_usage();
+        usage.signals += internal::signal_usage(construction_);
+        usage.signals += internal::signal_usage(destruction_);
+        return usage;
+    }
+
 public:
     auto on_construct() noexcept {
         return Sink{construction_};
@@ -92,9 +228,64 @@ public:
         return Sink{destruction_};
     }
 
+    //! @brief disconnect every listener
+    void clear_listeners() noexcept {
+        construction_.clear();
+        destruction_.clear();
+    }
+
+private:
+    sigh_type construction_;
+    sigh_type destruction_;
+};
+
+template <typename EntityType>
+class SighMixin<BasicEntityPool<EntityType>> : public BasicEntityPool<EntityType> {
+public:
+    using underlying_type = BasicEntityPool<EntityType>;
+    using entity_type = typename underlying_type::entity_type;
+    using sigh_type = Sigh<void(entity_type)>;
+
+    auto emplace() {
+        auto entity = underlying_type::emplace();
+        if (!construction_.empty()) {
+            construction_.trigger(entity);
+        }
+        return entity;
+    }
+
+    void remove(entity_type entity) {
+        if (!destruction_.empty()) {
+            destruction_.trigger(entity);
+        }
+        underlying_type::remove(entity);
+    }
+
+    MemoryUsage memory_usage() const noexcept {
+        auto usage = underlying_type::memory_usage();
+        usage.signals += internal::signal_usage(construction_);
+        usage.signals += internal::signal_usage(destruction_);
+        return usage;
+    }
+
+public:
+    auto on_construct() noexcept {
+        return Sink{construction_};
+    }
+
+    auto on_destruction() noexcept {
+        return Sink{destruction_};
+    }
+
+    //! @brief disconnect every listener
+    void clear_listeners() noexcept {
+        construction_.clear();
+        destruction_.clear();
+    }
+
 private:
     sigh_type construction_;
     sigh_type destruction_;
 };
 
-} // namespace wecs
\ No newline at end of file
+} // namespace wecs
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "wecs/entity/registry.hpp"
+
+namespace wecs {
+
+template <typename EntityType, size_t PageSize,
+          typename EntityStorage = SighMixin<BasicStorage<EntityType, EntityType, PageSize, void>>>
+class BasicObserver {
+public:
+    using registry_type = BasicRegistry<EntityType, PageSize, EntityStorage>;
+    using base_type = BasicSparseSet<EntityType, PageSize>;
+    using iterator = typename base_type::iterator;
+
+    BasicObserver(registry_type& registry) : registry_{&registry} {}
+    ~BasicObserver() { disconnect(); }
+
+    BasicObserver(const BasicObserver&) = delete;
+    BasicObserver& operator=(const BasicObserver&) = delete;
+
+    //! @brief collect entities that get Type emplaced while matching the filters
+    template <typename Type, typename Filter = Require<>, typename Without = Exclude<>>
+    BasicObserver& construct() {
+        registry_->template on_construct<Type>().template connect<&BasicObserver::template maybe_insert<Filter, Without>>(*this);
+        releases_.push_back(&release_construct<Type>);
+        return watch<Type>(Filter{}, Without{});
+    }
+
+    //! @brief collect entities that get Type patched while matching the filters
+    template <typename Type, typename Filter = Require<>, typename Without = Exclude<>>
+    BasicObserver& update() {
+        registry_->template on_update<Type>().template connect<&BasicObserver::template maybe_insert<Filter, Without>>(*this);
+        releases_.push_back(&release_update<Type>);
+        return watch<Type>(Filter{}, Without{});
+    }
+
+    void disconnect() {
+        for (auto release : releases_) {
+            release(*registry_, this);
+        }
+        releases_.clear();
+    }
+
+public:
+    bool empty() const noexcept {
+        return storage_.empty();
+    }
+
+    auto size() const noexcept {
+        return storage_.size();
+    }
+
+    bool contain(EntityType entity) const {
+        return storage_.contain(entity);
+    }
+
+    iterator begin() const noexcept {
+        return storage_.begin();
+    }
+
+    iterator end() const noexcept {
+        return storage_.end();
+    }
+
+    template <typename Func>
+    void each(Func func) const {
+        for (auto entity : storage_) {
+            func(static_cast<EntityType>(entity));
+        }
+    }
+
+    void clear() noexcept {
+        storage_.clear();
+    }
+
+private:
+    template <typename Type, typename... Filter, typename... Without>
+    BasicObserver& watch(TypeList<Filter...>, TypeList<Without...>) {
+        registry_->template on_destruction<Type>().template connect<&BasicObserver::discard>(*this);
+        releases_.push_back(&release_destruction<Type>);
+        ((registry_->template on_destruction<Filter>().template connect<&BasicObserver::discard>(*this),
+          releases_.push_back(&release_destruction<Filter>)), ...);
+        ((registry_->template on_construct<Without>().template connect<&BasicObserver::discard>(*this),
+          releases_.push_back(&release_construct<Without>)), ...);
+        return *this;
+    }
+
+    template <typename Filter, typename Without>
+    void maybe_insert(EntityType entity) {
+        if (!storage_.contain(entity) && match(entity, Filter{}, Without{})) {
+            storage_.insert(entity);
+        }
+    }
+
+    template <typename... Filter, typename... Without>
+    bool match(EntityType entity, TypeList<Filter...>, TypeList<Without...>) const {
+        return registry_->template all_of<Filter...>(entity) && registry_->template none_of<Without...>(entity);
+    }
+
+    void discard(EntityType entity) {
+        if (storage_.contain(entity)) {
+            storage_.remove(entity);
+        }
+    }
+
+    template <typename Type>
+    static void release_construct(registry_type& registry, const void* payload) {
+        registry.template on_construct<Type>().disconnect(payload);
+    }
+
+    template <typename Type>
+    static void release_update(registry_type& registry, const void* payload) {
+        registry.template on_update<Type>().disconnect(payload);
+    }
+
+    template <typename Type>
+    static void release_destruction(registry_type& registry, const void* payload) {
+        registry.template on_destruction<Type>().disconnect(payload);
+    }
+
+private:
+    registry_type* registry_;
+    base_type storage_;
+    std::vector<void (*)(registry_type&, const void*)> releases_;
+};
+
+} // namespace wecs
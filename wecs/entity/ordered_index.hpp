@@ -0,0 +1,484 @@
+#pragma once
+
+#include "wecs/entity/hash_index.hpp"
+#include <algorithm>
+#include <iterator>
+#include <optional>
+
+namespace wecs {
+
+namespace internal {
+
+template <typename Key, typename EntityType>
+struct OrderedEntry {
+    Key key{};
+    EntityType entity = empty_entity;
+
+    // entities break ties, so that every entry is unique and can be found again
+    bool operator<(const OrderedEntry& other) const {
+        if (key < other.key) {
+            return true;
+        }
+        if (other.key < key) {
+            return false;
+        }
+        return to_integral(entity) < to_integral(other.entity);
+    }
+};
+
+template <typename Entry, size_t Capacity>
+struct OrderedNode {
+    bool leaf;
+    size_t count = 0;
+};
+
+//! @brief entries in order, one slot more than capacity so that a node can split after inserting
+template <typename Entry, size_t Capacity>
+struct OrderedLeaf : OrderedNode<Entry, Capacity> {
+    OrderedLeaf() : OrderedNode<Entry, Capacity>{true} {}
+
+    std::array<Entry, Capacity + 1u> entries;
+    OrderedLeaf* next = nullptr;
+};
+
+//! @brief count children, separated by count - 1 entries: separators[i] is no greater
+//! than anything below children[i + 1] and greater than anything below children[i]
+template <typename Entry, size_t Capacity>
+struct OrderedInner : OrderedNode<Entry, Capacity> {
+    OrderedInner() : OrderedNode<Entry, Capacity>{false} {}
+
+    std::array<Entry, Capacity> separators;
+    std::array<OrderedNode<Entry, Capacity>*, Capacity + 1u> children;
+};
+
+template <typename Leaf>
+class OrderedIndexIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = decltype(std::declval<Leaf>().entries[0].entity);
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    OrderedIndexIterator() = default;
+
+    OrderedIndexIterator(const Leaf* leaf, size_t pos) noexcept : leaf_{leaf}, pos_{pos} {}
+
+    OrderedIndexIterator& operator++() noexcept {
+        if (++pos_ == leaf_->count) {
+            leaf_ = leaf_->next;
+            pos_ = 0;
+        }
+        return *this;
+    }
+
+    OrderedIndexIterator operator++(int) noexcept {
+        auto copy = *this;
+        ++*this;
+        return copy;
+    }
+
+    reference operator*() const noexcept {
+        return leaf_->entries[pos_].entity;
+    }
+
+    pointer operator->() const noexcept {
+        return &**this;
+    }
+
+    //! @brief the value the current entity is indexed under
+    const auto& key() const noexcept {
+        return leaf_->entries[pos_].key;
+    }
+
+    bool operator==(const OrderedIndexIterator& other) const noexcept {
+        return leaf_ == other.leaf_ && pos_ == other.pos_;
+    }
+
+    bool operator!=(const OrderedIndexIterator& other) const noexcept {
+        return !(*this == other);
+    }
+
+private:
+    const Leaf* leaf_ = nullptr;
+    size_t pos_ = 0;
+};
+
+} // namespace internal
+
+//! @brief B+-tree over a member of the components in a SighMixin pool, for range queries
+//!
+//! Entries are (key, entity) pairs sorted by key, ties broken by entity, so
+//! duplicated keys are fine. Nodes span a few cache lines and leaves are
+//! chained, so a range is a short descent followed by a linear walk. Ranges are
+//! plain iterator pairs over entities, which registry.each() joins with other
+//! pools and registry.view() turns into a view. As with BasicHashIndex, only
+//! emplace, patch, replace and remove are seen; call refresh() after other writes.
+template <typename Storage, typename Key>
+class BasicOrderedIndex final : public internal::IndexBase {
+public:
+    using storage_type = Storage;
+    using entity_type = typename storage_type::entity_type;
+    using payload_type = typename storage_type::payload_type;
+    using key_type = Key;
+    using member_type = Key payload_type::*;
+    using entry_type = internal::OrderedEntry<Key, entity_type>;
+
+    //! @brief entries per node, about four cache lines of them
+    static constexpr size_t node_capacity = std::max<size_t>(8u, 4u * config::cache_line_size / sizeof(entry_type));
+    static constexpr size_t sparse_page_size = std::tuple_size_v<typename storage_type::base_type::page_type>;
+
+    using node_type = internal::OrderedNode<entry_type, node_capacity>;
+    using leaf_type = internal::OrderedLeaf<entry_type, node_capacity>;
+    using inner_type = internal::OrderedInner<entry_type, node_capacity>;
+    using iterator = internal::OrderedIndexIterator<leaf_type>;
+
+    struct Range {
+        iterator first;
+        iterator last;
+
+        iterator begin() const noexcept { return first; }
+        iterator end() const noexcept { return last; }
+    };
+
+    BasicOrderedIndex(storage_type& pool, member_type member)
+        : pool_{&pool}, member_{member}, root_{new leaf_type} {
+        pool_->on_construct().template connect<&BasicOrderedIndex::insert>(*this);
+        pool_->on_update().template connect<&BasicOrderedIndex::update>(*this);
+        pool_->on_destruction().template connect<&BasicOrderedIndex::erase>(*this);
+        rebuild();
+    }
+
+    ~BasicOrderedIndex() override {
+        pool_->on_construct().disconnect(this);
+        pool_->on_update().disconnect(this);
+        pool_->on_destruction().disconnect(this);
+        release(root_);
+    }
+
+    BasicOrderedIndex(const BasicOrderedIndex&) = delete;
+    BasicOrderedIndex& operator=(const BasicOrderedIndex&) = delete;
+
+    //! @brief entities in ascending order of their keys
+    iterator begin() const noexcept {
+        return size_ != 0u ? iterator{first_leaf(), 0} : end();
+    }
+
+    iterator end() const noexcept {
+        return iterator{};
+    }
+
+    //! @brief the first entity whose key isn't less than key
+    iterator lower_bound(const key_type& key) const {
+        return bound(key, [](const key_type& lhs, const key_type& rhs) { return lhs < rhs; });
+    }
+
+    //! @brief the first entity whose key is greater than key
+    iterator upper_bound(const key_type& key) const {
+        return bound(key, [](const key_type& lhs, const key_type& rhs) { return !(rhs < lhs); });
+    }
+
+    //! @brief entities with keys in [lower, upper)
+    Range range(const key_type& lower, const key_type& upper) const {
+        return Range{lower_bound(lower), lower_bound(upper)};
+    }
+
+    //! @brief entities with exactly key
+    Range equal_range(const key_type& key) const {
+        return Range{lower_bound(key), upper_bound(key)};
+    }
+
+    //! @brief re-read the key of entity, after writes the signals didn't see
+    void refresh(entity_type entity) {
+        update(entity, (*pool_)[entity]);
+    }
+
+    //! @brief index every entity of the pool from scratch
+    void rebuild() {
+        clear();
+        for (auto value : pool_->packed()) {
+            insert(static_cast<entity_type>(value), (*pool_)[static_cast<entity_type>(value)]);
+        }
+    }
+
+    void clear() override {
+        release(root_);
+        root_ = new leaf_type;
+        keys_.clear();
+        size_ = 0;
+        height_ = 1;
+    }
+
+public:
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    //! @brief levels of the tree, leaves included
+    size_t height() const noexcept {
+        return height_;
+    }
+
+    member_type member() const noexcept {
+        return member_;
+    }
+
+private:
+    struct Split {
+        entry_type separator;
+        node_type* right;
+    };
+
+    static inner_type& inner(node_type* node) noexcept {
+        return static_cast<inner_type&>(*node);
+    }
+
+    static leaf_type& leaf(node_type* node) noexcept {
+        return static_cast<leaf_type&>(*node);
+    }
+
+    static void release(node_type* node) noexcept {
+        if (node->leaf) {
+            delete &leaf(node);
+        } else {
+            auto& self = inner(node);
+            for (size_t i = 0; i < self.count; i++) {
+                release(self.children[i]);
+            }
+            delete &self;
+        }
+    }
+
+    const leaf_type* first_leaf() const noexcept {
+        auto* node = root_;
+        while (!node->leaf) {
+            node = inner(node).children[0];
+        }
+        return &leaf(node);
+    }
+
+    // descend past every separator whose key is before key, then skip the
+    // entries of the leaf that are
+    template <typename Before>
+    iterator bound(const key_type& key, Before before) const {
+        auto* node = root_;
+        while (!node->leaf) {
+            auto& self = inner(node);
+            size_t child = 0;
+            while (child + 1u < self.count && before(self.separators[child].key, key)) {
+                child++;
+            }
+            node = self.children[child];
+        }
+        const auto* current = &leaf(node);
+        size_t pos = 0;
+        while (pos < current->count && before(current->entries[pos].key, key)) {
+            pos++;
+        }
+        if (pos == current->count) {
+            return current->next ? iterator{current->next, 0} : end();
+        }
+        return iterator{current, pos};
+    }
+
+    void insert(entity_type entity, const payload_type& payload) {
+        const entry_type entry{payload.*member_, entity};
+        if (auto split = insert_into(root_, entry)) {
+            auto* root = new inner_type;
+            root->count = 2;
+            root->separators[0] = split->separator;
+            root->children[0] = root_;
+            root->children[1] = split->right;
+            root_ = root;
+            height_++;
+        }
+        keys_.emplace(entity, entry.key);
+        size_++;
+    }
+
+    std::optional<Split> insert_into(node_type* node, const entry_type& entry) {
+        if (node->leaf) {
+            auto& self = leaf(node);
+            auto pos = static_cast<size_t>(std::upper_bound(self.entries.begin(), self.entries.begin() + self.count, entry) - self.entries.begin());
+            std::move_backward(self.entries.begin() + pos, self.entries.begin() + self.count, self.entries.begin() + self.count + 1);
+            self.entries[pos] = entry;
+            if (++self.count <= node_capacity) {
+                return std::nullopt;
+            }
+            auto* right = new leaf_type;
+            right->count = self.count / 2u;
+            self.count -= right->count;
+            std::move(self.entries.begin() + self.count, self.entries.begin() + self.count + right->count, right->entries.begin());
+            right->next = self.next;
+            self.next = right;
+            return Split{right->entries[0], right};
+        }
+        auto& self = inner(node);
+        const auto child = child_of(self, entry);
+        auto split = insert_into(self.children[child], entry);
+        if (!split) {
+            return std::nullopt;
+        }
+        std::move_backward(self.separators.begin() + child, self.separators.begin() + self.count - 1, self.separators.begin() + self.count);
+        std::move_backward(self.children.begin() + child + 1, self.children.begin() + self.count, self.children.begin() + self.count + 1);
+        self.separators[child] = split->separator;
+        self.children[child + 1] = split->right;
+        if (++self.count <= node_capacity) {
+            return std::nullopt;
+        }
+        // the separator between the halves moves up instead of staying in either
+        auto* right = new inner_type;
+        right->count = self.count / 2u;
+        self.count -= right->count;
+        std::move(self.separators.begin() + self.count, self.separators.begin() + self.count + right->count - 1, right->separators.begin());
+        std::move(self.children.begin() + self.count, self.children.begin() + self.count + right->count, right->children.begin());
+        return Split{self.separators[self.count - 1], right};
+    }
+
+    void update(entity_type entity, const payload_type& payload) {
+        if (!(keys_[entity] == payload.*member_)) {
+            erase(entity, payload);
+            insert(entity, payload);
+        }
+    }
+
+    void erase(entity_type entity, const payload_type&) {
+        [[maybe_unused]] const auto found = erase_from(root_, entry_type{keys_[entity], entity});
+        WECS_ASSERT(found, "entity not indexed");
+        if (!root_->leaf && root_->count == 1u) {
+            auto* child = inner(root_).children[0];
+            inner(root_).count = 0;
+            release(root_);
+            root_ = child;
+            height_--;
+        }
+        keys_.remove(entity);
+        size_--;
+    }
+
+    bool erase_from(node_type* node, const entry_type& entry) {
+        if (node->leaf) {
+            auto& self = leaf(node);
+            auto it = std::lower_bound(self.entries.begin(), self.entries.begin() + self.count, entry);
+            if (it == self.entries.begin() + self.count || entry < *it) {
+                return false;
+            }
+            std::move(it + 1, self.entries.begin() + self.count, it);
+            self.count--;
+            return true;
+        }
+        auto& self = inner(node);
+        const auto child = child_of(self, entry);
+        if (!erase_from(self.children[child], entry)) {
+            return false;
+        }
+        if (self.children[child]->count < node_capacity / 2u) {
+            rebalance(self, child);
+        }
+        return true;
+    }
+
+    static size_t child_of(const inner_type& self, const entry_type& entry) {
+        return static_cast<size_t>(std::upper_bound(self.separators.begin(), self.separators.begin() + self.count - 1, entry) - self.separators.begin());
+    }
+
+    // borrow one from a sibling that can spare it, otherwise merge with one
+    void rebalance(inner_type& parent, size_t child) {
+        if (child > 0u && parent.children[child - 1]->count > node_capacity / 2u) {
+            borrow_left(parent, child);
+        } else if (child + 1u < parent.count && parent.children[child + 1]->count > node_capacity / 2u) {
+            borrow_right(parent, child);
+        } else if (child + 1u < parent.count) {
+            merge(parent, child);
+        } else if (child > 0u) {
+            merge(parent, child - 1u);
+        }
+    }
+
+    void borrow_left(inner_type& parent, size_t child) {
+        auto* node = parent.children[child];
+        auto* sibling = parent.children[child - 1];
+        auto& separator = parent.separators[child - 1];
+        if (node->leaf) {
+            auto& self = leaf(node);
+            auto& left = leaf(sibling);
+            std::move_backward(self.entries.begin(), self.entries.begin() + self.count, self.entries.begin() + self.count + 1);
+            self.entries[0] = left.entries[--left.count];
+            self.count++;
+            separator = self.entries[0];
+        } else {
+            auto& self = inner(node);
+            auto& left = inner(sibling);
+            std::move_backward(self.separators.begin(), self.separators.begin() + self.count - 1, self.separators.begin() + self.count);
+            std::move_backward(self.children.begin(), self.children.begin() + self.count, self.children.begin() + self.count + 1);
+            self.separators[0] = separator;
+            self.children[0] = left.children[left.count - 1];
+            self.count++;
+            separator = left.separators[left.count - 2];
+            left.count--;
+        }
+    }
+
+    void borrow_right(inner_type& parent, size_t child) {
+        auto* node = parent.children[child];
+        auto* sibling = parent.children[child + 1];
+        auto& separator = parent.separators[child];
+        if (node->leaf) {
+            auto& self = leaf(node);
+            auto& right = leaf(sibling);
+            self.entries[self.count++] = right.entries[0];
+            std::move(right.entries.begin() + 1, right.entries.begin() + right.count, right.entries.begin());
+            right.count--;
+            separator = right.entries[0];
+        } else {
+            auto& self = inner(node);
+            auto& right = inner(sibling);
+            self.separators[self.count - 1] = separator;
+            self.children[self.count] = right.children[0];
+            self.count++;
+            separator = right.separators[0];
+            std::move(right.separators.begin() + 1, right.separators.begin() + right.count - 1, right.separators.begin());
+            std::move(right.children.begin() + 1, right.children.begin() + right.count, right.children.begin());
+            right.count--;
+        }
+    }
+
+    // fold children[child + 1] into children[child]
+    void merge(inner_type& parent, size_t child) {
+        auto* node = parent.children[child];
+        auto* sibling = parent.children[child + 1];
+        if (node->leaf) {
+            auto& self = leaf(node);
+            auto& right = leaf(sibling);
+            std::move(right.entries.begin(), right.entries.begin() + right.count, self.entries.begin() + self.count);
+            self.count += right.count;
+            self.next = right.next;
+        } else {
+            auto& self = inner(node);
+            auto& right = inner(sibling);
+            self.separators[self.count - 1] = parent.separators[child];
+            std::move(right.separators.begin(), right.separators.begin() + right.count - 1, self.separators.begin() + self.count);
+            std::move(right.children.begin(), right.children.begin() + right.count, self.children.begin() + self.count);
+            self.count += right.count;
+            right.count = 0;
+        }
+        release(sibling);
+        std::move(parent.separators.begin() + child + 1, parent.separators.begin() + parent.count - 1, parent.separators.begin() + child);
+        std::move(parent.children.begin() + child + 2, parent.children.begin() + parent.count, parent.children.begin() + child + 1);
+        parent.count--;
+    }
+
+private:
+    storage_type* pool_;
+    member_type member_;
+    node_type* root_;
+    size_t size_ = 0;
+    size_t height_ = 1;
+    BasicStorage<entity_type, key_type, sparse_page_size, std::allocator<key_type>> keys_;
+};
+
+} // namespace wecs
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "wecs/entity/view.hpp"
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+namespace wecs {
+
+namespace internal {
+
+template <typename Query>
+struct QueryIterator {
+    using entity_type = typename Query::entity_type;
+    using base_type = typename Query::base_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    QueryIterator() : query_{}, lead_{}, offset_{} {}
+
+    QueryIterator(Query* query, const base_type* lead, difference_type offset)
+        : query_{query}, lead_{lead}, offset_{offset} {
+        while (offset_ > 0 && !valid()) {
+            --offset_;
+        }
+    }
+
+    QueryIterator& operator++() {
+        while (--offset_ > 0 && !valid()) {}
+        return *this;
+    }
+
+    QueryIterator operator++(int) {
+        QueryIterator copy = *this;
+        return ++(*this), copy;
+    }
+
+    bool operator==(const QueryIterator& other) const {
+        return offset_ == other.offset_;
+    }
+
+    bool operator!=(const QueryIterator& other) const {
+        return !(*this == other);
+    }
+
+    auto operator*() const {
+        return query_->components(entity());
+    }
+
+private:
+    entity_type entity() const {
+        return static_cast<entity_type>(lead_->packed()[static_cast<size_t>(offset_ - 1)]);
+    }
+
+    bool valid() const {
+        return query_->contain(entity(), lead_);
+    }
+
+private:
+    Query* query_;
+    const base_type* lead_;
+    difference_type offset_;
+};
+
+} // namespace internal
+
+template <typename Registry, typename Without, typename... Types>
+class BasicQuery;
+
+//! @brief a view kept across frames, e.g. registry.query<Position, Velocity>(exclude<Frozen>)
+//!
+//! The pools are resolved once, when the query is built. Each pass then walks
+//! the smallest pool of Types in place, probing the others entity by entity, with
+//! no entity list to collect first. At least one of Types must not be a tag.
+template <typename Registry, typename... Excludes, typename... Types>
+class BasicQuery<Registry, Exclude<Excludes...>, Types...> {
+    template <typename Query>
+    friend struct internal::QueryIterator;
+
+public:
+    using registry_type = Registry;
+    using entity_type = typename registry_type::entity_type;
+    using base_type = typename registry_type::base_type;
+    template <typename Type>
+    using storage_for_t = typename registry_type::template storage_for_t<std::remove_const_t<Type>>;
+    using pool_container_type = std::tuple<constness_as_t<storage_for_t<Types>, Types>*...>;
+    using exclude_container_type = std::tuple<const storage_for_t<Excludes>*...>;
+    using iterator = internal::QueryIterator<BasicQuery>;
+
+    static_assert(sizeof...(Types) > 0, "you must provide query component");
+    static_assert((std::is_base_of_v<base_type, storage_for_t<Types>> || ...),
+                  "a query must include a component that isn't a tag");
+
+    BasicQuery(pool_container_type pools, exclude_container_type excludes)
+        : pools_{pools}, excludes_{excludes} {}
+
+    //! @brief the size of the pool a pass would walk, at least the number of matches
+    size_t size_hint() const noexcept {
+        return lead()->size();
+    }
+
+    iterator begin() {
+        const auto* lead = this->lead();
+        return iterator{this, lead, static_cast<typename iterator::difference_type>(lead->size())};
+    }
+
+    iterator end() {
+        return iterator{this, lead(), 0};
+    }
+
+    bool contain(entity_type entity) const {
+        return contain(entity, nullptr);
+    }
+
+    //! @brief call func(entity, components...) for every match, walking back to front
+    //! so that func may remove the components of the entity it is given
+    template <typename Func>
+    void each(Func func) {
+        const auto* lead = this->lead();
+        for (auto pos = lead->size(); pos-- > 0;) {
+            const auto entity = static_cast<entity_type>(lead->packed()[pos]);
+            if (contain(entity, lead)) {
+                std::apply([&func, entity](auto*... pool) { func(entity, (*pool)[entity]...); }, pools_);
+            }
+        }
+    }
+
+private:
+    const base_type* lead() const noexcept {
+        const base_type* result = nullptr;
+        std::apply([&result](const auto*... pool) { (pick(result, pool), ...); }, pools_);
+        return result;
+    }
+
+    template <typename Pool>
+    static void pick(const base_type*& result, const Pool* pool) noexcept {
+        if constexpr (std::is_base_of_v<base_type, Pool>) {
+            if (!result || pool->size() < result->size()) {
+                result = pool;
+            }
+        }
+    }
+
+    // entities of the lead pool are alive, so tag bits need no version check
+    bool contain(entity_type entity, const base_type* lead) const {
+        return std::apply([entity, lead](const auto*... pool) { return (probe(pool, lead, entity) && ...); }, pools_) &&
+               std::apply([entity](const auto*... pool) { return !(pool->contain(entity) || ...); }, excludes_);
+    }
+
+    template <typename Pool>
+    static bool probe(const Pool* pool, const base_type* lead, entity_type entity) {
+        if constexpr (std::is_base_of_v<base_type, Pool>) {
+            if (static_cast<const base_type*>(pool) == lead) {
+                return true;
+            }
+        }
+        return pool->contain(entity);
+    }
+
+    auto components(entity_type entity) const {
+        return std::apply([entity](auto*... pool) {
+            return std::tuple<entity_type, decltype((*pool)[entity])...>(entity, (*pool)[entity]...);
+        }, pools_);
+    }
+
+private:
+    pool_container_type pools_;
+    exclude_container_type excludes_;
+};
+
+} // namespace wecs
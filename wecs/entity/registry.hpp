@@ -1,60 +1,161 @@
 #pragma once
 
 #include "wecs/core/ident.hpp"
+#include "wecs/core/memory.hpp"
 #include "wecs/entity/mixin.hpp"
+#include "wecs/entity/condition.hpp"
+#include "wecs/entity/hash_index.hpp"
+#include "wecs/entity/ordered_index.hpp"
+#include "wecs/entity/query.hpp"
+#include "wecs/entity/tag_storage.hpp"
 #include "wecs/entity/view.hpp"
 #include <optional>
+#ifdef WECS_ENABLE_STATS
+#include <unordered_map>
+#endif
 
 namespace wecs {
 
 namespace internal {
 
+//! @brief whether Type is an empty tag, stored as one bit per entity
+template <typename Type>
+inline constexpr bool is_tag_v = ComponentTraits<Type>::page_size == 0u;
+
 template <typename SparseSet, typename Type>
 struct StorageFor;
 
 template <typename EntityType, size_t PageSize, typename Type>
 struct StorageFor<BasicSparseSet<EntityType, PageSize>, Type> {
-    using type = SighMixin<BasicStorage<EntityType, Type, PageSize, std::allocator<Type>>>;
+    static constexpr auto page_alignment = ComponentTraits<Type>::page_alignment;
+    using allocator_type = std::conditional_t<(page_alignment > alignof(Type)), AlignedAllocator<Type, page_alignment>, std::allocator<Type>>;
+    using storage_type = std::conditional_t<is_soa_v<Type>, BasicSoaStorage<EntityType, Type, PageSize>,
+                                            BasicStorage<EntityType, Type, PageSize, allocator_type>>;
+    using tracked_type = std::conditional_t<ComponentTraits<Type>::track_ticks, TickMixin<storage_type>, storage_type>;
+    using signal_type = std::conditional_t<ComponentTraits<Type>::signal, SighMixin<tracked_type>, tracked_type>;
+    using type = std::conditional_t<is_tag_v<Type>, BasicTagStorage<EntityType, Type>, signal_type>;
 };
 
 template <typename SparseSet, typename Type>
 using storage_for_t = typename StorageFor<SparseSet, Type>::type;
 
+//! @brief whether Pool emits signals, having listeners to clear
+template <typename Pool, typename = void>
+struct has_listeners : std::false_type {};
+
+template <typename Pool>
+struct has_listeners<Pool, std::void_t<decltype(std::declval<Pool&>().clear_listeners())>> : std::true_type {};
+
 } // namespace internal
 
-template <typename EntityType, size_t PageSize>
+//! @tparam EntityStorage pool the entities are created from, a SighMixin over
+//! BasicStorage<EntityType, EntityType, PageSize, void> or BasicEntityPool<EntityType>
+template <typename EntityType, size_t PageSize,
+          typename EntityStorage = SighMixin<BasicStorage<EntityType, EntityType, PageSize, void>>>
 class BasicRegistry {
 public:
+    using entity_type = EntityType;
     using base_type = BasicSparseSet<EntityType, PageSize>;
     using pool_container_type = std::vector<std::shared_ptr<base_type>>;
+    using tag_set_type = BasicTagSet<EntityType>;
+    using tag_container_type = std::vector<std::shared_ptr<tag_set_type>>;
     template <typename Type>
     using storage_for_t = internal::storage_for_t<base_type, Type>;
-    using entities_container_type = SighMixin<BasicStorage<EntityType, EntityType, PageSize, void>>;
+    using entities_container_type = EntityStorage;
     using component_ident = Ident<struct ComponentIdent>;
+    using index_ident = Ident<struct IndexIdent>;
+    using tick_type = config::tick_type;
 
     template <typename... Types>
     using view_type = View<EntityType, BasicRegistry, Types...>;
+    template <typename Type, typename Key, bool Unique = false>
+    using hash_index_type = BasicHashIndex<storage_for_t<Type>, Key, Unique>;
+    template <typename Type, typename Key>
+    using ordered_index_type = BasicOrderedIndex<storage_for_t<Type>, Key>;
+    using condition_type = BasicCondition<BasicRegistry>;
+    template <typename... Types>
+    using query_type = BasicQuery<BasicRegistry, Exclude<>, Types...>;
+
+    BasicRegistry() = default;
+    BasicRegistry(BasicRegistry&&) = default;
+    BasicRegistry& operator=(BasicRegistry&&) = default;
+
+    //! @brief copies would share their pools, use clone() instead
+    BasicRegistry(const BasicRegistry&) = delete;
+    BasicRegistry& operator=(const BasicRegistry&) = delete;
+
+    //! @brief a copy of every entity and component, made from the pages of each pool
+    //! rather than by creating entities and emplacing components one by one
+    //!
+    //! Indices aren't copied, build them again on the clone. Listeners are copied only
+    //! when listeners is set, and then receive the signals of both registries.
+    BasicRegistry clone(bool listeners = false) const {
+        BasicRegistry copy;
+        copy.entities_ = entities_;
+        if constexpr (internal::has_listeners<entities_container_type>::value) {
+            if (!listeners) {
+                copy.entities_.clear_listeners();
+            }
+        }
+        *copy.tick_ = *tick_;
+        copy.pools_.resize(pools_.size());
+        copy.tags_.resize(tags_.size());
+        copy.pool_ops_ = pool_ops_;
+        for (size_t idx = 0; idx < pool_ops_.size(); idx++) {
+            if (storage(idx) || tag_set(idx)) {
+                WECS_ASSERT(pool_ops_[idx].clone, "component can't be copied");
+                pool_ops_[idx].clone(*this, copy, idx, listeners);
+            }
+        }
+        return copy;
+    }
 
     auto create() {
+        WECS_ACCESS_GUARD(entities_);
         auto entity = entities_.emplace();
         return entity;
     }
 
     void destroy(EntityType entity) {
         if (alive(entity)) {
-            entities_.remove(entity);
+            {
+                WECS_ACCESS_GUARD(entities_);
+                entities_.remove(entity);
+            }
             for (auto& pool : pools_) {
-                if (pool->contain(entity)) {
+                if (pool && pool->contain(entity)) {
+                    WECS_ACCESS_GUARD(*pool);
                     pool->remove(entity);
                 }
             }
+            for (auto& tags : tags_) {
+                if (tags && tags->contain(entity)) {
+                    WECS_ACCESS_GUARD(*tags);
+                    tags->remove(entity);
+                }
+            }
         }
     }
 
     void clear() {
-        entities_.clear();
+        {
+            WECS_ACCESS_GUARD(entities_);
+            entities_.clear();
+        }
         for (auto& pool : pools_) {
-            pool->clear();
+            if (pool) {
+                WECS_ACCESS_GUARD(*pool);
+                pool->clear();
+            }
+        }
+        for (auto& tags : tags_) {
+            if (tags) {
+                WECS_ACCESS_GUARD(*tags);
+                tags->clear();
+            }
+        }
+        for (auto& [id, index] : indices_) {
+            index->clear();
         }
     }
 
@@ -62,18 +163,23 @@ public:
         return entities_.contain(entity);
     }
 
+    //! @brief a reference to the component, or a SoaReference for components listing fields
     template <typename Type, typename... Args>
-    Type& emplace(EntityType entity, Args&&... args) {
-        return assure<Type>().emplace(entity, std::forward<Args>(args)...);
+    decltype(auto) emplace(EntityType entity, Args&&... args) {
+        auto& pool = assure<Type>();
+        WECS_ACCESS_GUARD(pool);
+        return pool.emplace(entity, std::forward<Args>(args)...);
     }
 
     template <typename Type, typename... Func>
-    Type& patch(EntityType entity, Func&&... func) {
-        return assure<Type>().patch(entity, std::forward<Func>(func)...);
+    decltype(auto) patch(EntityType entity, Func&&... func) {
+        auto& pool = assure<Type>();
+        WECS_ACCESS_GUARD(pool);
+        return pool.patch(entity, std::forward<Func>(func)...);
     }
 
     template <typename Type, typename... Args>
-    Type& replace(EntityType entity, Args&&... args) {
+    decltype(auto) replace(EntityType entity, Args&&... args) {
         return patch<Type>(entity, [&args...](auto&... component) {
             ((component = Type{std::forward<Args>(args)...}), ...);
         });
@@ -82,58 +188,298 @@ public:
     template <typename Type>
     bool has(EntityType entity) const {
         auto idx = component_ident::get<Type>();
-        if (idx >= pools_.size()) {
-            return false;
+        if constexpr (internal::is_tag_v<Type>) {
+            // bits don't know versions
+            const auto* tags = tag_set(idx);
+            return tags && tags->contain(entity) && alive(entity);
+        } else {
+            const auto* pool = storage(idx);
+            return pool && pool->contain(entity);
         }
-        return pools_[idx] && pools_[idx]->contain(entity);
+    }
+
+    //! @brief whether entity has every one of Types, stopping at the first it lacks
+    template <typename... Types>
+    bool all_of(EntityType entity) const {
+        if constexpr ((internal::is_tag_v<Types> || ...)) {
+            if (!alive(entity)) {
+                return false;
+            }
+        }
+        return (probe(find<Types>(), entity) && ...);
+    }
+
+    //! @brief whether entity has at least one of Types, stopping at the first it has
+    template <typename... Types>
+    bool any_of(EntityType entity) const {
+        if constexpr ((internal::is_tag_v<Types> || ...)) {
+            if (!alive(entity)) {
+                return false;
+            }
+        }
+        return (probe(find<Types>(), entity) || ...);
+    }
+
+    template <typename... Types>
+    bool none_of(EntityType entity) const {
+        return !any_of<Types...>(entity);
+    }
+
+    //! @brief an empty condition to add the types of a reusable presence test to
+    condition_type condition() {
+        return condition_type{*this};
     }
 
     template <typename Type>
     void remove(EntityType entity) {
-        assure<Type>().remove(entity);
+        auto& pool = assure<Type>();
+        WECS_ACCESS_GUARD(pool);
+        pool.remove(entity);
     }
 
-    template <typename Type>
-    const Type& get(EntityType entity) const {
-        auto idx = component_ident::get<Type>();
-        return static_cast<storage_for_t<Type>&>(*pools_[idx])[entity];
+    //! @brief the component of entity, or a tuple of them for several Types
+    template <typename... Types>
+    decltype(auto) get(EntityType entity) const {
+        if constexpr (sizeof...(Types) == 1u) {
+            return (get_one<Types>(entity), ...);
+        } else {
+            return std::tuple<decltype(get_one<Types>(entity))...>{get_one<Types>(entity)...};
+        }
     }
 
+    //! @brief a pointer to the component of entity, nullptr if it has none, or a tuple of them for several Types
+    template <typename... Types>
+    auto try_get(EntityType entity) const {
+        if constexpr (sizeof...(Types) == 1u) {
+            return (try_get_one<Types>(entity), ...);
+        } else {
+            return std::tuple{try_get_one<Types>(entity)...};
+        }
+    }
+
+    //! @brief mutable access, counted as a change for components tracking ticks
     template <typename Type>
-    Type& get_mutable(EntityType entity) {
-        return const_cast<Type&>(std::as_const(*this).template get<Type>(entity));
+    decltype(auto) get_mutable(EntityType entity) {
+        WECS_ASSERT(has<Type>(entity), "entity doesn't have the component");
+        auto& pool = assure<Type>();
+        if constexpr (ComponentTraits<Type>::track_ticks) {
+            WECS_ACCESS_GUARD(pool);
+            pool.touch(entity);
+        }
+        return pool[entity];
     }
 
     template <typename... Types>
     view_type<Types...> view() noexcept {
         WECS_ASSERT(sizeof...(Types) > 0, "you must provide query component");
         using view_list = typename view_type<Types...>::view_list;
+        const auto indices = component_idx(view_list{});
+        return with_stats(view_type<Types...>(storages(view_list{}), collect(indices)), indices);
+    }
+
+    //! @brief view over the entities in [first, last) that have every one of Types, e.g. a spatial query
+    template <typename... Types, typename It>
+    view_type<Types...> view(It first, It last) {
+        WECS_ASSERT(sizeof...(Types) > 0, "you must provide query component");
+        using view_list = typename view_type<Types...>::view_list;
+        auto pools = storages(view_list{});
         typename base_type::packed_container_type entities;
-        auto min_idx = idx_of_min_num(component_idx(view_list{}));
-        if (!min_idx.has_value()) {
-            return view_type<Types...>(storages(view_list{}), {});
+        for (; first != last; ++first) {
+            const auto entity = static_cast<EntityType>(*first);
+            if (std::apply([entity](auto*... pool) { return (pool->contain(entity) && ...); }, pools)) {
+                entities.push_back(to_integral(entity));
+            }
+        }
+        return with_stats(view_type<Types...>(pools, std::move(entities)), component_idx(view_list{}));
+    }
+
+    //! @brief view over the entities that have every one of Types and none of Excludes
+    template <typename... Types, typename... Excludes>
+    view_type<Types...> view(Exclude<Excludes...>) noexcept {
+        WECS_ASSERT(sizeof...(Types) > 0, "you must provide query component");
+        using view_list = typename view_type<Types...>::view_list;
+        const auto indices = component_idx(view_list{});
+        const auto excludes = component_idx(TypeList<Excludes...>{});
+        return with_stats(view_type<Types...>(storages(view_list{}), collect(indices, excludes)), indices);
+    }
+
+    //! @brief read-only view that never creates pools, safe to build concurrently
+    template <typename... Types>
+    view_type<const Types...> view() const noexcept {
+        WECS_ASSERT(sizeof...(Types) > 0, "you must provide query component");
+        using view_list = TypeList<Types...>;
+        return view_type<const Types...>(storages(view_list{}), collect(component_idx(view_list{})));
+    }
+
+    template <typename... Types, typename... Excludes>
+    view_type<const Types...> view(Exclude<Excludes...>) const noexcept {
+        WECS_ASSERT(sizeof...(Types) > 0, "you must provide query component");
+        using view_list = TypeList<Types...>;
+        const auto excludes = component_idx(TypeList<Excludes...>{});
+        return view_type<const Types...>(storages(view_list{}), collect(component_idx(view_list{}), excludes));
+    }
+
+    //! @brief hash index from member to the entities whose Type holds the value, built on first use
+    //! and kept by the registry, e.g. index<NetworkId>(&NetworkId::value).find(id)
+    //! @brief a query resolving the pools of Types once, to be kept by a system and run every frame
+    template <typename... Types>
+    query_type<Types...> query() {
+        return {storages(TypeList<Types...>{}), {}};
+    }
+
+    template <typename... Types, typename... Excludes>
+    BasicQuery<BasicRegistry, Exclude<Excludes...>, Types...> query(Exclude<Excludes...>) {
+        return {storages(TypeList<Types...>{}), std::tuple{static_cast<const storage_for_t<Excludes>*>(&assure<Excludes>())...}};
+    }
+
+    template <typename Type, typename Key>
+    hash_index_type<Type, Key>& index(Key Type::*member) {
+        return assure_index<hash_index_type<Type, Key>>(member);
+    }
+
+    //! @brief like index(), asserting that no two entities hold the same value
+    template <typename Type, typename Key>
+    hash_index_type<Type, Key, true>& unique_index(Key Type::*member) {
+        return assure_index<hash_index_type<Type, Key, true>>(member);
+    }
+
+    //! @brief B+-tree from member to the entities whose Type holds the value, for range
+    //! queries, built on first use and kept by the registry
+    template <typename Type, typename Key>
+    ordered_index_type<Type, Key>& ordered_index(Key Type::*member) {
+        return assure_index<ordered_index_type<Type, Key>>(member);
+    }
+
+    //! @brief call func(entity, components...) for the entities in [first, last) that have
+    //! every one of Types, in that order, e.g. joining an index range without collecting it first
+    template <typename... Types, typename It, typename Func>
+    void each(It first, It last, Func func) {
+        static_assert(sizeof...(Types) > 0, "you must provide query component");
+        auto pools = storages(TypeList<Types...>{});
+        for (; first != last; ++first) {
+            const auto entity = static_cast<EntityType>(*first);
+            std::apply([&func, entity](auto*... pool) {
+                if ((pool->contain(entity) && ...)) {
+                    func(entity, (*pool)[entity]...);
+                }
+            }, pools);
+        }
+    }
+
+    //! @brief move the entities of [first, last) with all their components into other, pool by pool
+    //!
+    //! Each entity is given a new entity in other, written to out in order, and destroyed
+    //! here. A pool is walked once for the whole batch: its components are emplaced in
+    //! other, firing other's on_construct, then removed here, firing on_destruction.
+    //! Trivially copyable components are copied as plain bytes, others copied when they
+    //! can be and moved otherwise, so that destruction listeners here see them intact.
+    //! @return out past the last entity written
+    template <typename It, typename Out>
+    Out move_to(BasicRegistry& other, It first, It last, Out out) {
+        WECS_ASSERT(&other != this, "entities moved into their own registry");
+        const std::vector<EntityType> sources(first, last);
+        std::vector<EntityType> targets;
+        targets.reserve(sources.size());
+        for (auto entity : sources) {
+            WECS_ASSERT(alive(entity), "entity not alive");
+            targets.push_back(other.create());
+            *out++ = targets.back();
+        }
+        for (auto& ops : pool_ops_) {
+            if (ops.move) {
+                ops.move(*this, other, sources, targets);
+            }
+        }
+        WECS_ACCESS_GUARD(entities_);
+        for (auto entity : sources) {
+            entities_.remove(entity);
+        }
+        return out;
+    }
+
+    //! @brief create the pools of Types up front, so that const access never has to
+    template <typename... Types>
+    void prepare() {
+        (assure<Types>(), ...);
+    }
+
+    //! @brief the pool of the component with identifier id, nullptr if it has none yet
+    base_type* storage(config::id_type id) noexcept {
+        return id < pools_.size() ? pools_[id].get() : nullptr;
+    }
+
+    const base_type* storage(config::id_type id) const noexcept {
+        return id < pools_.size() ? pools_[id].get() : nullptr;
+    }
+
+    template <typename Type>
+    storage_for_t<Type>& storage() {
+        return assure<Type>();
+    }
+
+    //! @brief memory of the entity pool and every component pool, tags included
+    MemoryUsage memory_usage() const noexcept {
+        auto usage = entities_.memory_usage();
+        for (auto& pool : pools_) {
+            if (pool) {
+                usage += pool->memory_usage();
+            }
+        }
+        for (auto& tags : tags_) {
+            if (tags) {
+                usage += tags->memory_usage();
+            }
+        }
+        return usage;
+    }
+
+    void shrink_to_fit() {
+        entities_.shrink_to_fit();
+        for (auto& pool : pools_) {
+            if (pool) {
+                pool->shrink_to_fit();
+            }
         }
-        for (size_t i = 0; i < pools_[min_idx.value()]->size(); i++) {
-            auto entity = pools_[min_idx.value()]->packed()[i];
-            if (entity_has_other_component(static_cast<EntityType>(entity), view_list{})) {
-                entities.push_back(entity);
+        for (auto& tags : tags_) {
+            if (tags) {
+                tags->shrink_to_fit();
             }
         }
-        return view_type<Types...>(storages(view_list{}), entities);
     }
 
+#ifdef WECS_ENABLE_STATS
+    RegistryStats stats() const {
+        RegistryStats stats;
+        auto entities = entities_.stats();
+        stats.entities = entities_.size();
+        stats.peak_entities = entities.peak_size;
+        for (size_t i = 0; i < pools_.size(); i++) {
+            if (pools_[i]) {
+                stats.pools.push_back(pools_[i]->stats());
+                stats.pools.back().id = static_cast<config::id_type>(i);
+            }
+        }
+        for (auto& [key, view] : view_stats_) {
+            stats.views.push_back(view);
+        }
+        return stats;
+    }
+#endif
+
 public:
     template <typename Type>
     auto on_construct() noexcept {
         if constexpr (std::is_same_v<Type, EntityType>) {
             return Sink{entities_.on_construct()};
         } else {
+            static_assert(ComponentTraits<Type>::signal && !internal::is_tag_v<Type>, "signal is disabled for this component");
             return Sink{assure<Type>().on_construct()};
         }
     }
 
     template <typename Type>
     auto on_update() noexcept {
+        static_assert(ComponentTraits<Type>::signal && !internal::is_tag_v<Type>, "signal is disabled for this component");
         return Sink{assure<Type>().on_update()};
     }
 
@@ -142,6 +488,7 @@ public:
         if constexpr (std::is_same_v<Type, EntityType>) {
             return Sink{entities_.on_destruction()};
         } else {
+            static_assert(ComponentTraits<Type>::signal && !internal::is_tag_v<Type>, "signal is disabled for this component");
             return Sink{assure<Type>().on_destruction()};
         }
     }
@@ -151,71 +498,330 @@ public:
         return entities_.size();
     }
 
+    //! @brief the tick stamped on components that track ticks
+    tick_type tick() const noexcept {
+        return *tick_;
+    }
+
+    //! @brief start a new tick, returning it
+    tick_type advance() noexcept {
+        return ++*tick_;
+    }
+
 private:
     template <typename Type>
     storage_for_t<Type>& assure() {
         using storage_type = storage_for_t<Type>;
         auto idx = component_ident::get<Type>();
-        if (idx >= pools_.size()) {
-            pools_.resize(idx + 1);
+        if constexpr (internal::is_tag_v<Type>) {
+            if (idx >= tags_.size()) {
+                tags_.resize(idx + 1);
+            }
+            if (!tags_[idx]) {
+                tags_[idx] = std::make_shared<storage_type>();
+                bind_ops<Type>(idx);
+            }
+            return static_cast<storage_type&>(*tags_[idx]);
+        } else {
+            if (idx >= pools_.size()) {
+                pools_.resize(idx + 1);
+            }
+            if (!pools_[idx]) {
+                auto pool = std::make_shared<storage_type>();
+                if constexpr (ComponentTraits<Type>::track_ticks) {
+                    pool->bind(tick_.get());
+                }
+                pools_[idx] = std::move(pool);
+                bind_ops<Type>(idx);
+            }
+            return static_cast<storage_type&>(*pools_[idx]);
         }
-        if (!pools_[idx]) {
-            pools_[idx] = std::make_shared<storage_type>();
+    }
+
+    // what can be done to the pool of a component without knowing its type
+    struct PoolOps {
+        void (*move)(BasicRegistry&, BasicRegistry&, const std::vector<EntityType>&, const std::vector<EntityType>&) = nullptr;
+        void (*clone)(const BasicRegistry&, BasicRegistry&, size_t, bool) = nullptr;
+    };
+
+    template <typename Type>
+    void bind_ops(size_t idx) {
+        if (idx >= pool_ops_.size()) {
+            pool_ops_.resize(idx + 1);
+        }
+        pool_ops_[idx].move = &move_pool<Type>;
+        if constexpr (std::is_copy_constructible_v<Type>) {
+            pool_ops_[idx].clone = &clone_pool<Type>;
         }
-        return static_cast<storage_type&>(*pools_[idx]);
+    }
+
+    template <typename Type>
+    static void clone_pool(const BasicRegistry& from, BasicRegistry& to, size_t idx, [[maybe_unused]] bool listeners) {
+        using storage_type = storage_for_t<Type>;
+        if constexpr (internal::is_tag_v<Type>) {
+            to.tags_[idx] = std::make_shared<storage_type>(static_cast<const storage_type&>(*from.tags_[idx]));
+        } else {
+            auto pool = std::make_shared<storage_type>(static_cast<const storage_type&>(*from.pools_[idx]));
+            if constexpr (ComponentTraits<Type>::track_ticks) {
+                pool->bind(to.tick_.get());
+            }
+            if constexpr (internal::has_listeners<storage_type>::value) {
+                if (!listeners) {
+                    pool->clear_listeners();
+                }
+            }
+            to.pools_[idx] = std::move(pool);
+        }
+    }
+
+    template <typename Type>
+    static void move_pool(BasicRegistry& from, BasicRegistry& to, const std::vector<EntityType>& sources,
+                          const std::vector<EntityType>& targets) {
+        auto& source = from.assure<Type>();
+        if (source.empty()) {
+            return;
+        }
+        auto& target = to.assure<Type>();
+        {
+            WECS_ACCESS_GUARD(target);
+            if constexpr (!internal::is_tag_v<Type>) {
+                target.reserve(target.size() + std::min(source.size(), sources.size()));
+            }
+            for (size_t i = 0; i < sources.size(); i++) {
+                if (!source.contain(sources[i])) {
+                    continue;
+                }
+                if constexpr (internal::is_tag_v<Type>) {
+                    target.insert(targets[i]);
+                } else if constexpr (internal::is_soa_v<Type>) {
+                    target.emplace(targets[i], static_cast<Type>(source[sources[i]]));
+                } else if constexpr (std::is_copy_constructible_v<Type>) {
+                    target.emplace(targets[i], std::as_const(source[sources[i]]));
+                } else {
+                    target.emplace(targets[i], std::move(source[sources[i]]));
+                }
+            }
+        }
+        WECS_ACCESS_GUARD(source);
+        for (auto entity : sources) {
+            if (source.contain(entity)) {
+                source.remove(entity);
+            }
+        }
+    }
+
+    template <typename Index, typename Member>
+    Index& assure_index(Member member) {
+        using payload_type = typename Index::payload_type;
+        static_assert(ComponentTraits<payload_type>::signal && !internal::is_soa_v<payload_type>,
+                      "indexed components must emit signals and be stored as a whole");
+        const auto id = index_ident::get<Index>();
+        for (auto& [other, index] : indices_) {
+            if (other == id && static_cast<Index&>(*index).member() == member) {
+                return static_cast<Index&>(*index);
+            }
+        }
+        auto index = std::make_shared<Index>(assure<payload_type>(), member);
+        indices_.emplace_back(id, index);
+        return *index;
     }
 
     template <typename... Types>
     std::array<size_t, sizeof...(Types)> component_idx(TypeList<Types...>) const {
-        return {component_ident::get<Types>()...};
+        return {component_ident::get<std::remove_const_t<Types>>()...};
+    }
+
+    const tag_set_type* tag_set(size_t idx) const noexcept {
+        return idx < tags_.size() ? tags_[idx].get() : nullptr;
     }
 
+    template <typename Type>
+    decltype(auto) get_one(EntityType entity) const {
+        WECS_ASSERT(has<Type>(entity), "entity doesn't have the component");
+        if constexpr (internal::is_tag_v<Type>) {
+            return Type{};
+        } else {
+            auto idx = component_ident::get<Type>();
+            return static_cast<const storage_for_t<Type>&>(*pools_[idx])[entity];
+        }
+    }
+
+    template <typename Type>
+    const Type* try_get_one(EntityType entity) const {
+        static_assert(!internal::is_soa_v<Type>, "components stored by field have no address");
+        const auto* pool = find<Type>();
+        if constexpr (internal::is_tag_v<Type>) {
+            return pool && alive(entity) ? pool->try_get(entity) : nullptr;
+        } else {
+            return pool ? pool->try_get(entity) : nullptr;
+        }
+    }
+
+    // tag bits are tested without versions, callers check alive() first
+    template <typename Pool>
+    static bool probe(const Pool* pool, EntityType entity) {
+        return pool && pool->contain(entity);
+    }
+
+    // the smallest pool of indices, tags left out: nullopt for tags alone, or with
+    // missing set when one of them has neither a pool nor a tag set yet
     template <size_t N>
-    std::optional<size_t> idx_of_min_num(const std::array<size_t, N>& indices) {
+    std::optional<size_t> idx_of_min_num(const std::array<size_t, N>& indices, bool& missing) const {
         size_t min_num = std::numeric_limits<size_t>::max();
         size_t min_idx = 0;
+        missing = false;
         for (auto idx : indices) {
-            if (idx >= pools_.size() || !pools_[idx]) {
+            if (const auto* pool = storage(idx)) {
+                if (min_num > pool->size()) {
+                    min_num = pool->size();
+                    min_idx = idx;
+                }
+            } else if (!tag_set(idx)) {
+                missing = true;
                 return std::nullopt;
             }
-            if (min_num > pools_[idx]->size()) {
-                min_num = pools_[idx]->size();
-                min_idx = idx;
-            }
         }
         return min_num == std::numeric_limits<size_t>::max() ? std::nullopt : std::make_optional(min_idx);
     }
 
+    // bits set for the entities of pool or tag set idx, none if there is neither
+    uint32_t contain_mask(size_t idx, const typename base_type::entity_type* entities, size_t count) const {
+        if (const auto* pool = storage(idx)) {
+            return pool->contain_mask(entities, count);
+        }
+        if (const auto* tags = tag_set(idx)) {
+            return tags->contain_mask(entities, count);
+        }
+        return 0u;
+    }
+
     template <typename... Types>
     auto storages(TypeList<Types...>) {
-        return std::tuple{&assure<Types>()...};
+        return std::tuple{&assure<std::remove_const_t<Types>>()...};
     }
 
-    struct Check {
-        template <typename T>
-        bool has(EntityType entity, const pool_container_type& pools) const {
-            auto idx = component_ident::get<T>();
-            return idx < pools.size() && pools[idx] && pools[idx]->contain(entity);
-        }
-    };
-
     template <typename... Types>
-    bool entity_has_other_component(EntityType entity, TypeList<Types...> list) {
-        return check(entity, list, Check{});
+    auto storages(TypeList<Types...>) const {
+        return std::tuple{find<std::remove_const_t<Types>>()...};
     }
 
-    template <typename T, typename... Ts, typename F>
-    bool check(EntityType entity, TypeList<T, Ts...>, F f) {
-        if constexpr (sizeof...(Ts) == 0) {
-            return f.template has<T>(entity, pools_);
+    template <typename Type>
+    const storage_for_t<Type>* find() const noexcept {
+        if constexpr (internal::is_tag_v<Type>) {
+            return static_cast<const storage_for_t<Type>*>(tag_set(component_ident::get<Type>()));
         } else {
-            return f.template has<T>(entity, pools_) && check(entity, TypeList<Ts...>{}, f);
+            return static_cast<const storage_for_t<Type>*>(storage(component_ident::get<Type>()));
+        }
+    }
+
+    // match the lead pool block by block, one bitmask per other pool or tag set,
+    // excluded ones clearing bits
+    template <size_t N, size_t M = 0>
+    typename base_type::packed_container_type collect(const std::array<size_t, N>& indices,
+                                                      const std::array<size_t, M>& excludes = {}) const {
+        typename base_type::packed_container_type entities;
+        bool missing;
+        auto min_idx = idx_of_min_num(indices, missing);
+        if (missing || N == 0u) {
+            return entities;
+        }
+        if (!min_idx.has_value()) {
+            return collect_tags(indices, excludes);
+        }
+        const auto& lead = *pools_[min_idx.value()];
+        const auto* data = lead.packed().data();
+        constexpr size_t block = 16;
+        for (size_t i = 0; i < lead.size(); i += block) {
+            const auto count = std::min(block, lead.size() - i);
+            uint32_t mask = (1u << count) - 1u;
+            for (auto idx : indices) {
+                if (idx != min_idx.value() && mask) {
+                    mask &= contain_mask(idx, data + i, count);
+                }
+            }
+            for (auto idx : excludes) {
+                if (mask) {
+                    mask &= ~contain_mask(idx, data + i, count);
+                }
+            }
+            for (; mask; mask &= mask - 1u) {
+                entities.push_back(data[i + static_cast<size_t>(count_trailing_zeros(mask))]);
+            }
+        }
+        return entities;
+    }
+
+    // views of tags alone: AND the words of the included tags, ANDNOT those of the
+    // excluded ones, 64 entities at a time, then look the survivors up by index
+    template <size_t N, size_t M>
+    typename base_type::packed_container_type collect_tags(const std::array<size_t, N>& indices,
+                                                           const std::array<size_t, M>& excludes) const {
+        using traits_type = EntityTraits<EntityType>;
+        constexpr auto word_bits = tag_set_type::word_bits;
+        typename base_type::packed_container_type entities;
+        size_t length = std::numeric_limits<size_t>::max();
+        for (auto idx : indices) {
+            length = std::min(length, tag_set(idx)->words().size());
+        }
+        for (size_t pos = 0; pos < length; pos++) {
+            auto word = tag_set(indices[0])->words()[pos];
+            for (size_t i = 1; i < N && word; i++) {
+                word &= tag_set(indices[i])->words()[pos];
+            }
+            for (auto idx : excludes) {
+                const auto* tags = tag_set(idx);
+                if (tags && pos < tags->words().size()) {
+                    word &= ~tags->words()[pos];
+                }
+            }
+            for (; word; word &= word - 1u) {
+                const auto index = pos * word_bits + static_cast<size_t>(count_trailing_zeros(word));
+                const auto entity = entities_.current(static_cast<typename traits_type::entity_type>(index));
+                const bool excluded = std::any_of(excludes.begin(), excludes.end(), [this, entity](auto idx) {
+                    const auto* pool = storage(idx);
+                    return pool && pool->contain(entity);
+                });
+                if (!excluded) {
+                    entities.push_back(to_integral(entity));
+                }
+            }
+        }
+        return entities;
+    }
+
+    template <typename View, size_t N>
+    View with_stats(View&& view, [[maybe_unused]] const std::array<size_t, N>& indices) {
+#ifdef WECS_ENABLE_STATS
+        auto& stats = view_stats_[GET_TYPE_INFO(typename View::view_list)];
+        if (stats.components.empty()) {
+            stats.components.assign(indices.begin(), indices.end());
+        }
+        stats.constructions++;
+        view.bind_stats(&stats.iterations);
+#endif
+        return std::move(view);
+    }
+
+    static int count_trailing_zeros(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(value);
+#else
+        int count = 0;
+        for (; !(value & 1u); value >>= 1) {
+            count++;
         }
+        return count;
+#endif
     }
 
 private:
     pool_container_type pools_;
+    tag_container_type tags_;
     entities_container_type entities_;
+    std::shared_ptr<tick_type> tick_ = std::make_shared<tick_type>();
+    std::vector<std::pair<config::id_type, std::shared_ptr<internal::IndexBase>>> indices_;
+    std::vector<PoolOps> pool_ops_;
+    WECS_STATS(std::unordered_map<config::type_info, ViewStats> view_stats_;)
 };
 
 } // namespace wecs
\ No newline at end of file
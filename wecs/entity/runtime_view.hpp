@@ -0,0 +1,145 @@
+#pragma once
+
+#include "wecs/entity/sparse_set.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace wecs {
+
+namespace internal {
+
+template <typename View>
+struct RuntimeViewIterator {
+    using entity_type = typename View::entity_type;
+    using base_type = typename View::base_type;
+    using container_type = typename View::container_type;
+    using difference_type = std::ptrdiff_t;
+    using value_type = entity_type;
+    using pointer = const entity_type*;
+    using reference = entity_type;
+    using iterator_category = std::forward_iterator_tag;
+
+    RuntimeViewIterator() : view_{}, lead_{}, offset_{} {}
+
+    RuntimeViewIterator(const View* view, const base_type* lead, difference_type offset)
+        : view_{view}, lead_{lead}, offset_{offset} {
+        while (offset_ > 0 && !valid()) {
+            --offset_;
+        }
+    }
+
+    RuntimeViewIterator& operator++() {
+        while (--offset_ > 0 && !valid()) {}
+        return *this;
+    }
+
+    RuntimeViewIterator operator++(int) {
+        RuntimeViewIterator copy = *this;
+        return ++(*this), copy;
+    }
+
+    bool operator==(const RuntimeViewIterator& other) const {
+        return offset_ == other.offset_;
+    }
+
+    bool operator!=(const RuntimeViewIterator& other) const {
+        return !(*this == other);
+    }
+
+    reference operator*() const {
+        return static_cast<entity_type>(lead_->packed()[offset_ - 1]);
+    }
+
+private:
+    bool valid() const {
+        const auto entity = operator*();
+        return view_->contain(entity, lead_);
+    }
+
+private:
+    const View* view_;
+    const base_type* lead_;
+    difference_type offset_;
+};
+
+} // namespace internal
+
+//! @brief view over pools chosen at runtime, iterating the smallest in place
+template <typename EntityType, size_t PageSize>
+class BasicRuntimeView {
+public:
+    using entity_type = EntityType;
+    using base_type = BasicSparseSet<EntityType, PageSize>;
+    using container_type = std::vector<const base_type*>;
+    using iterator = internal::RuntimeViewIterator<BasicRuntimeView>;
+
+    BasicRuntimeView& iterate(const base_type& pool) {
+        pools_.push_back(&pool);
+        return *this;
+    }
+
+    BasicRuntimeView& exclude(const base_type& pool) {
+        filter_.push_back(&pool);
+        return *this;
+    }
+
+    void clear() noexcept {
+        pools_.clear();
+        filter_.clear();
+    }
+
+public:
+    //! @brief upper bound of the number of entities, the size of the smallest pool
+    size_t size_hint() const noexcept {
+        const auto* lead = this->lead();
+        return lead ? lead->size() : 0;
+    }
+
+    bool contain(EntityType entity) const {
+        return !pools_.empty() && contain(entity, nullptr);
+    }
+
+    iterator begin() const {
+        const auto* lead = this->lead();
+        return lead ? iterator{this, lead, static_cast<typename iterator::difference_type>(lead->size())} : end();
+    }
+
+    iterator end() const {
+        return iterator{this, nullptr, 0};
+    }
+
+    template <typename Func>
+    void each(Func func) const {
+        for (auto entity : *this) {
+            func(entity);
+        }
+    }
+
+    const auto& pools() const noexcept { return pools_; }
+    const auto& filter() const noexcept { return filter_; }
+
+private:
+    friend iterator;
+
+    const base_type* lead() const noexcept {
+        auto it = std::min_element(pools_.begin(), pools_.end(), [](const auto* lhs, const auto* rhs) {
+            return lhs->size() < rhs->size();
+        });
+        return it != pools_.end() ? *it : nullptr;
+    }
+
+    bool contain(EntityType entity, const base_type* skip) const {
+        return std::all_of(pools_.begin(), pools_.end(), [entity, skip](const auto* pool) {
+                   return pool == skip || pool->contain(entity);
+               }) &&
+               std::none_of(filter_.begin(), filter_.end(), [entity](const auto* pool) {
+                   return pool->contain(entity);
+               });
+    }
+
+private:
+    container_type pools_;
+    container_type filter_;
+};
+
+} // namespace wecs
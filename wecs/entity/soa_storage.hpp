@@ -0,0 +1,353 @@
+#pragma once
+
+#include "wecs/entity/sparse_set.hpp"
+#include "wecs/entity/component.hpp"
+#include "wecs/core/memory.hpp"
+#include "wecs/config/config.hpp"
+#include <cstring>
+#include <new>
+#include <tuple>
+
+namespace wecs {
+
+namespace internal {
+
+template <typename Member>
+struct MemberType;
+
+template <typename Class, typename Type>
+struct MemberType<Type Class::*> {
+    using class_type = Class;
+    using type = Type;
+};
+
+template <typename Fields, bool Const>
+struct FieldPointers;
+
+template <typename... Members, bool Const>
+struct FieldPointers<std::tuple<Members...>, Const> {
+    using type = std::tuple<std::conditional_t<Const, const typename MemberType<Members>::type,
+                                               typename MemberType<Members>::type>*...>;
+};
+
+template <typename Type>
+using field_list_t = std::remove_const_t<decltype(ComponentTraits<Type>::fields)>;
+
+//! @brief whether Type lists its fields and is stored field by field
+template <typename Type>
+inline constexpr bool is_soa_v = std::tuple_size_v<field_list_t<Type>> != 0u;
+
+//! @brief stands in for a reference to a component whose fields live in separate arrays
+//!
+//! Reads and writes go through the fields, either one at a time with get<I>() or
+//! all at once by converting to and assigning from Payload.
+template <typename Payload, bool Const>
+class SoaReference {
+    static constexpr size_t field_count = std::tuple_size_v<field_list_t<Payload>>;
+    using indices = std::make_index_sequence<field_count>;
+
+public:
+    using payload_type = Payload;
+    using pointer_tuple = typename FieldPointers<field_list_t<Payload>, Const>::type;
+
+    explicit SoaReference(pointer_tuple pointers) noexcept : pointers_{pointers} {}
+
+    SoaReference(const SoaReference&) = default;
+
+    //! @brief assign the fields referred to by other, not rebind
+    SoaReference& operator=(const SoaReference& other) {
+        return *this = static_cast<Payload>(other);
+    }
+
+    SoaReference& operator=(const Payload& value) {
+        store(value, indices{});
+        return *this;
+    }
+
+    //! @brief the I-th field listed in ComponentTraits<Payload>::fields
+    template <size_t I>
+    auto& get() const noexcept {
+        return *std::get<I>(pointers_);
+    }
+
+    operator Payload() const {
+        return load(indices{});
+    }
+
+private:
+    template <size_t... I>
+    Payload load(std::index_sequence<I...>) const {
+        constexpr auto fields = ComponentTraits<Payload>::fields;
+        Payload value{};
+        ((value.*std::get<I>(fields) = *std::get<I>(pointers_)), ...);
+        return value;
+    }
+
+    template <size_t... I>
+    void store(const Payload& value, std::index_sequence<I...>) {
+        constexpr auto fields = ComponentTraits<Payload>::fields;
+        ((*std::get<I>(pointers_) = value.*std::get<I>(fields)), ...);
+    }
+
+private:
+    pointer_tuple pointers_;
+};
+
+} // namespace internal
+
+//! @brief storage laying out every field of Payload in its own aligned page array
+//!
+//! Chosen by the registry for components listing their fields in
+//! ComponentTraits::fields. Payload must be default constructible and the
+//! listed fields must cover every member, since whole components are
+//! rebuilt from them. Elements are accessed through SoaReference proxies,
+//! so there is no payload to hand out from value().
+template <typename EntityType, typename Payload, size_t PageSize>
+class BasicSoaStorage : public BasicSparseSet<EntityType, PageSize> {
+    using field_list = internal::field_list_t<Payload>;
+    static constexpr size_t field_count = std::tuple_size_v<field_list>;
+    using indices = std::make_index_sequence<field_count>;
+
+public:
+    using entity_type = EntityType;
+    using payload_type = Payload;
+    using base_type = BasicSparseSet<EntityType, PageSize>;
+    using component_traits = ComponentTraits<payload_type>;
+    using reference = internal::SoaReference<Payload, false>;
+    using const_reference = internal::SoaReference<Payload, true>;
+    using page_type = std::array<void*, field_count>;
+    using container_type = std::vector<page_type>;
+
+    template <size_t Index>
+    using field_type = typename internal::MemberType<std::tuple_element_t<Index, field_list>>::type;
+
+    static constexpr size_t page_size = component_traits::page_size;
+    static constexpr size_t page_align = std::max(config::cache_line_size, component_traits::page_alignment);
+
+    static_assert(page_size > 0u, "fields of empty types can't be laid out");
+
+    BasicSoaStorage() {}
+    ~BasicSoaStorage() override { clear(); }
+
+    //! @brief copy the field pages of other, trivially copyable fields as raw bytes
+    BasicSoaStorage(const BasicSoaStorage& other) : base_type{other} {
+        const auto size = base_type::size();
+        pages_.reserve((size + page_size - 1u) / page_size);
+        for (size_t page = 0; page * page_size < size; page++) {
+            pages_.push_back(allocate(indices{}));
+            copy_page(other, page, std::min(page_size, size - page * page_size), indices{});
+        }
+    }
+
+    BasicSoaStorage& operator=(const BasicSoaStorage&) = delete;
+
+    template <typename... Args>
+    reference emplace(EntityType value, Args&&... args) {
+        WECS_ASSERT(!base_type::contain(value), "entity already exists");
+        Payload payload{std::forward<Args>(args)...};
+        base_type::insert(value);
+        WECS_STATS(base_type::stats_.emplace++);
+        const auto pos = base_type::index(value);
+        assure(pos);
+        construct(pos, std::move(payload), indices{});
+        return element_at(pos, indices{});
+    }
+
+    //! @brief func is applied to a copy of the component, written back field by field
+    template <typename... Func>
+    reference patch(EntityType value, Func&&... func) {
+        WECS_ASSERT(base_type::contain(value), "entity not found");
+        auto elem = element_at(base_type::index(value), indices{});
+        auto payload = static_cast<Payload>(elem);
+        (std::forward<Func>(func)(payload), ...);
+        elem = payload;
+        WECS_STATS(base_type::stats_.patch++);
+        return elem;
+    }
+
+    void remove(EntityType value) override {
+        WECS_ASSERT(base_type::contain(value), "entity not found");
+        pop(base_type::index(value), base_type::size() - 1u, indices{});
+        base_type::remove(value);
+        WECS_STATS(base_type::stats_.remove++);
+    }
+
+    const_reference operator[](EntityType value) const noexcept {
+        return element_at(base_type::index(value), indices{});
+    }
+
+    reference operator[](EntityType value) noexcept {
+        return element_at(base_type::index(value), indices{});
+    }
+
+    void swap_elements(EntityType lhs, EntityType rhs) override {
+        WECS_ASSERT(base_type::contain(lhs) && base_type::contain(rhs), "entity not found");
+        swap_fields(base_type::index(lhs), base_type::index(rhs), indices{});
+        base_type::swap_elements(lhs, rhs);
+    }
+
+    //! @brief hint the cache to load every field of value, reading its sparse slot
+    void prefetch(EntityType value) const noexcept {
+        const auto pos = base_type::index(value);
+        if (pos < base_type::size()) {
+            prefetch(pos, indices{});
+        }
+    }
+
+    //! @brief the Index-th field array of page, page_size elements long
+    template <size_t Index>
+    field_type<Index>* field(size_t page) noexcept {
+        return static_cast<field_type<Index>*>(pages_[page][Index]);
+    }
+
+    template <size_t Index>
+    const field_type<Index>* field(size_t page) const noexcept {
+        return static_cast<const field_type<Index>*>(pages_[page][Index]);
+    }
+
+    //! @brief call func(count, fields...) once per page, with one array per field
+    //!
+    //! The arrays are page_align aligned and hold count elements, in packed order.
+    template <typename Func>
+    void each(Func func) {
+        const auto size = base_type::size();
+        for (size_t page = 0; page * page_size < size; page++) {
+            call(func, page, std::min(page_size, size - page * page_size), indices{});
+        }
+    }
+
+    void clear() noexcept override {
+        for (size_t pos = 0; pos < base_type::size(); pos++) {
+            destroy(pos, indices{});
+        }
+        release_pages(0);
+        base_type::clear();
+    }
+
+    MemoryUsage memory_usage() const noexcept override {
+        auto usage = base_type::memory_usage();
+        usage.payload = {pages_.capacity() * sizeof(page_type) + pages_.size() * page_size * row_size(),
+                         pages_.size() * sizeof(page_type) + base_type::size() * row_size()};
+        return usage;
+    }
+
+    //! @brief also release the field pages past the last element
+    void shrink_to_fit() override {
+        release_pages((base_type::size() + page_size - 1u) / page_size);
+        pages_.shrink_to_fit();
+        base_type::shrink_to_fit();
+    }
+
+    const auto& pages() const noexcept { return pages_; }
+
+private:
+    template <size_t Index>
+    auto& field_at(size_t pos) const noexcept {
+        return static_cast<field_type<Index>*>(pages_[pos / page_size][Index])[pos % page_size];
+    }
+
+    template <size_t... Index>
+    reference element_at(size_t pos, std::index_sequence<Index...>) noexcept {
+        return reference{std::make_tuple(&field_at<Index>(pos)...)};
+    }
+
+    template <size_t... Index>
+    const_reference element_at(size_t pos, std::index_sequence<Index...>) const noexcept {
+        return const_reference{std::make_tuple(static_cast<const field_type<Index>*>(&field_at<Index>(pos))...)};
+    }
+
+    template <size_t... Index>
+    void swap_fields(size_t lhs, size_t rhs, std::index_sequence<Index...>) {
+        using std::swap;
+        (swap(field_at<Index>(lhs), field_at<Index>(rhs)), ...);
+    }
+
+    template <size_t... Index>
+    void prefetch(size_t pos, std::index_sequence<Index...>) const noexcept {
+        (WECS_PREFETCH(&field_at<Index>(pos)), ...);
+    }
+
+    template <size_t... Index>
+    void construct(size_t pos, Payload&& payload, std::index_sequence<Index...>) {
+        constexpr auto fields = component_traits::fields;
+        (new (&field_at<Index>(pos)) field_type<Index>{std::move(payload.*std::get<Index>(fields))}, ...);
+    }
+
+    template <size_t... Index>
+    void copy_page(const BasicSoaStorage& other, size_t page, size_t count, std::index_sequence<Index...>) {
+        (copy_field<Index>(other, page, count), ...);
+    }
+
+    template <size_t Index>
+    void copy_field(const BasicSoaStorage& other, size_t page, size_t count) {
+        using type = field_type<Index>;
+        if constexpr (std::is_trivially_copyable_v<type>) {
+            std::memcpy(field<Index>(page), other.template field<Index>(page), count * sizeof(type));
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                new (field<Index>(page) + i) type{other.template field<Index>(page)[i]};
+            }
+        }
+    }
+
+    template <size_t... Index>
+    void destroy(size_t pos, std::index_sequence<Index...>) noexcept {
+        (field_at<Index>(pos).~field_type<Index>(), ...);
+    }
+
+    template <size_t... Index>
+    void pop(size_t pos, size_t last, std::index_sequence<Index...>) {
+        ((field_at<Index>(pos) = std::move(field_at<Index>(last))), ...);
+        destroy(last, indices{});
+    }
+
+    template <typename Func, size_t... Index>
+    void call(Func& func, size_t page, size_t count, std::index_sequence<Index...>) {
+        func(count, field<Index>(page)...);
+    }
+
+    template <size_t Index>
+    static constexpr size_t field_align() noexcept {
+        return std::max(page_align, alignof(field_type<Index>));
+    }
+
+    template <size_t... Index>
+    static page_type allocate(std::index_sequence<Index...>) {
+        return {aligned_allocate(page_size * sizeof(field_type<Index>), field_align<Index>())...};
+    }
+
+    template <size_t... Index>
+    static void deallocate(const page_type& page, std::index_sequence<Index...>) noexcept {
+        (aligned_deallocate(page[Index], field_align<Index>()), ...);
+    }
+
+    template <size_t... Index>
+    static constexpr size_t row_size(std::index_sequence<Index...>) noexcept {
+        return (sizeof(field_type<Index>) + ...);
+    }
+
+    static constexpr size_t row_size() noexcept {
+        return row_size(indices{});
+    }
+
+    void assure(size_t pos) {
+        const auto idx = pos / page_size;
+        [[maybe_unused]] const auto old = pages_.size();
+        while (pages_.size() <= idx) {
+            pages_.push_back(allocate(indices{}));
+        }
+        WECS_STATS(base_type::stats_.page_allocations += pages_.size() - old);
+    }
+
+    void release_pages(size_t from) noexcept {
+        for (size_t i = from; i < pages_.size(); i++) {
+            deallocate(pages_[i], indices{});
+        }
+        pages_.resize(std::min(from, pages_.size()));
+    }
+
+private:
+    container_type pages_;
+};
+
+} // namespace wecs
@@ -1,13 +1,21 @@
 #pragma once
 
 #include "wecs/entity/entity.hpp"
+#include "wecs/entity/stats.hpp"
+#include "wecs/core/access.hpp"
+#include "wecs/core/memory.hpp"
 #include "wecs/config/config.hpp"
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <memory>
 #include <vector>
 #include <utility>
 
+#ifdef WECS_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
 namespace wecs {
 
 namespace internal {
@@ -113,7 +121,8 @@ public:
     using entity_type = typename traits_type::entity_type;
     using page_type = std::array<size_t, PageSize>;
     using packed_container_type = std::vector<entity_type>;
-    using sparse_container_type = std::vector<page_type>;
+    //! @brief one contiguous run of pages, which the vectorized lookups index across
+    using sparse_container_type = std::vector<page_type, AlignedAllocator<page_type, config::sparse_page_alignment>>;
     static constexpr typename page_type::value_type npos = std::numeric_limits<typename page_type::value_type>::max();
     using iterator = internal::SparseSetIterator<BasicSparseSet>;
     using const_iterator = iterator;
@@ -123,8 +132,9 @@ public:
     auto insert(EntityType value) {
         auto entity = to_entity(value);
         WECS_ASSERT(traits_type::entity_mask != entity, "invalid entity");
-        packed_.push_back(to_integral(entity));
+        packed_.push_back(to_integral(value));
         assure(page(entity))[offset(entity)] = packed_.size() - 1u;
+        WECS_STATS(stats_.peak_size = std::max(stats_.peak_size, packed_.size()));
         return traits_type::construct(
             static_cast<typename traits_type::entity_type>(packed_.size() - 1u),
             0
@@ -152,12 +162,55 @@ public:
         return pos != npos && packed_[pos] == to_integral(value);
     }
 
+    //! @brief bit i is set when entities[i] is contained, count is at most 32
+    uint32_t contain_mask(const entity_type* entities, size_t count) const {
+        WECS_ASSERT(count <= 32, "too many entities");
+        uint32_t mask = 0;
+        size_t i = 0;
+#ifdef WECS_SIMD_AVX2
+        if constexpr (sizeof(entity_type) == 4 && sizeof(typename page_type::value_type) == 8) {
+            for (; i + 8 <= count; i += 8) {
+                mask |= contain_mask8(entities + i) << i;
+            }
+        }
+#endif
+        for (; i < count; i++) {
+            mask |= static_cast<uint32_t>(contain(static_cast<EntityType>(entities[i]))) << i;
+        }
+        return mask;
+    }
+
     size_t index(EntityType value) const {
         auto entity = to_entity(value);
         auto page = this->page(entity);
         return page < sparse_.size() ? sparse_[page][offset(entity)] : npos;
     }
 
+    //! @brief hint the cache to load the sparse slot of value
+    void prefetch_index(EntityType value) const noexcept {
+        auto entity = to_entity(value);
+        auto page = this->page(entity);
+        if (page < sparse_.size()) {
+            WECS_PREFETCH(&sparse_[page][offset(entity)]);
+        }
+    }
+
+    //! @brief type-erased access to the payload of value, nullptr without payload
+    virtual const void* value(EntityType value) const {
+        WECS_ASSERT(contain(value), "entity not found");
+        return nullptr;
+    }
+
+    void* value(EntityType value) {
+        return const_cast<void*>(std::as_const(*this).value(value));
+    }
+
+    //! @brief exchange the packed positions of two entities, with whatever is stored alongside
+    virtual void swap_elements(EntityType lhs, EntityType rhs) {
+        WECS_ASSERT(contain(lhs) && contain(rhs), "entity not found");
+        swap(lhs, rhs);
+    }
+
     auto& swap(EntityType lhs, EntityType rhs) {
         auto& ref1 = sparse_ref(to_entity(lhs));
         auto& ref2 = sparse_ref(to_entity(rhs));
@@ -183,11 +236,30 @@ public:
         packed_.reserve(capacity);
     }
 
-    void clear() noexcept {
+    virtual void clear() noexcept {
         packed_.clear();
         sparse_.clear();
     }
 
+    //! @brief bytes reserved and used by the sparse pages and the packed array
+    virtual MemoryUsage memory_usage() const noexcept {
+        MemoryUsage usage;
+        usage.sparse = {sparse_.capacity() * sizeof(page_type), sparse_.size() * sizeof(page_type)};
+        usage.packed = {packed_.capacity() * sizeof(entity_type), packed_.size() * sizeof(entity_type)};
+        return usage;
+    }
+
+    //! @brief release trailing sparse pages without entities and unused capacity
+    virtual void shrink_to_fit() {
+        while (!sparse_.empty() && std::all_of(sparse_.back().begin(), sparse_.back().end(), [](auto pos) {
+                   return pos == npos;
+               })) {
+            sparse_.pop_back();
+        }
+        sparse_.shrink_to_fit();
+        packed_.shrink_to_fit();
+    }
+
     iterator begin() const noexcept {
         return {packed_, static_cast<typename iterator::difference_type>(packed_.size())};
     }
@@ -207,6 +279,23 @@ public:
     const auto& packed() const noexcept { return packed_; }
     auto& packed() noexcept { return std::as_const(*this).packed(); } 
 
+    const auto& sparse() const noexcept { return sparse_; }
+
+#ifdef WECS_ACCESS_CHECK
+    //! @brief held by the registry around writes to this pool
+    AccessChecker& access() const noexcept { return access_; }
+#endif
+
+#ifdef WECS_ENABLE_STATS
+    PoolStats stats() const noexcept {
+        PoolStats stats = stats_;
+        stats.sparse_pages = sparse_.size();
+        stats.sparse_bytes = sparse_.size() * sizeof(page_type);
+        stats.size = size();
+        return stats;
+    }
+#endif
+
     const_iterator find(EntityType value) noexcept {
         if (contain(value)) {
             return {packed_, static_cast<typename iterator::difference_type>(index(value)) + 1};
@@ -216,6 +305,37 @@ public:
     }
 
 private:
+#ifdef WECS_SIMD_AVX2
+    // gathers the sparse slots of eight entities, then their packed values
+    uint32_t contain_mask8(const entity_type* entities) const {
+        if (sparse_.empty()) {
+            return 0;
+        }
+        const auto* sparse = reinterpret_cast<const long long*>(sparse_.front().data());
+        const auto* packed = reinterpret_cast<const int*>(packed_.data());
+        const auto limit = static_cast<int>(sparse_.size() * PageSize);
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(entities));
+        const __m256i entity = _mm256_and_si256(values, _mm256_set1_epi32(static_cast<int>(traits_type::entity_mask)));
+        const __m256i in_range = _mm256_cmpgt_epi32(_mm256_set1_epi32(limit), entity);
+        const __m256i npos_vec = _mm256_set1_epi64x(-1);
+        const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+        uint32_t mask = 0;
+        for (int half = 0; half < 2; half++) {
+            const __m128i entity4 = half ? _mm256_extracti128_si256(entity, 1) : _mm256_castsi256_si128(entity);
+            const __m128i values4 = half ? _mm256_extracti128_si256(values, 1) : _mm256_castsi256_si128(values);
+            const __m128i range4 = half ? _mm256_extracti128_si256(in_range, 1) : _mm256_castsi256_si128(in_range);
+            const __m256i pos = _mm256_mask_i64gather_epi64(npos_vec, sparse, _mm256_cvtepu32_epi64(entity4),
+                                                            _mm256_cvtepi32_epi64(range4), 8);
+            const __m256i found = _mm256_andnot_si256(_mm256_cmpeq_epi64(pos, npos_vec), npos_vec);
+            const __m128i found4 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(found, even));
+            const __m128i stored = _mm256_mask_i64gather_epi32(_mm_setzero_si128(), packed, pos, found4, 4);
+            const __m128i equal = _mm_and_si128(_mm_cmpeq_epi32(stored, values4), found4);
+            mask |= static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(equal))) << (half * 4);
+        }
+        return mask;
+    }
+#endif
+
     size_t page(entity_type entity) const {
         return entity / PageSize;
     }
@@ -228,6 +348,7 @@ private:
         if (page >= sparse_.size()) {
             const size_t old = sparse_.size();
             sparse_.resize(page + 1);
+            WECS_STATS(stats_.page_allocations += sparse_.size() - old);
             for (size_t i = old; i < sparse_.size(); i++) {
                 std::uninitialized_fill(std::begin(sparse_[i]), std::end(sparse_[i]), npos);
             }
@@ -248,6 +369,12 @@ private:
 private:
     packed_container_type packed_;
     sparse_container_type sparse_;
+#ifdef WECS_ACCESS_CHECK
+    mutable AccessChecker access_;
+#endif
+
+protected:
+    WECS_STATS(PoolStats stats_;)
 };
 
 } // namespace wecs
\ No newline at end of file
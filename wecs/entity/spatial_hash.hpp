@@ -0,0 +1,175 @@
+#pragma once
+
+#include "wecs/entity/registry.hpp"
+#include <cmath>
+#include <unordered_map>
+
+namespace wecs {
+
+//! @brief uniform grid over the X/Y members of a component, kept up to date by its signals
+//!
+//! Entities are bucketed by the cell their position falls into, each cell holding
+//! its entities and their coordinates in contiguous arrays. Positions written with
+//! the registry's emplace, patch or replace are tracked; writes through
+//! get_mutable or views bypass the signals and need refresh().
+template <typename EntityType, size_t PageSize, auto X, auto Y,
+          typename EntityStorage = SighMixin<BasicStorage<EntityType, EntityType, PageSize, void>>>
+class BasicSpatialHash {
+    using x_member = internal::MemberType<decltype(X)>;
+    using y_member = internal::MemberType<decltype(Y)>;
+
+    static_assert(std::is_same_v<typename x_member::class_type, typename y_member::class_type> &&
+                  std::is_same_v<typename x_member::type, typename y_member::type>,
+                  "coordinates must be members of the same type and component");
+
+public:
+    using registry_type = BasicRegistry<EntityType, PageSize, EntityStorage>;
+    using entity_type = EntityType;
+    using component_type = typename x_member::class_type;
+    using coord_type = typename x_member::type;
+    using key_type = uint64_t;
+
+    static_assert(ComponentTraits<component_type>::signal && !internal::is_soa_v<component_type>,
+                  "the component must emit signals and be stored as a whole");
+
+    struct Cell {
+        std::vector<entity_type> entities;
+        std::vector<std::array<coord_type, 2>> points;
+    };
+
+    BasicSpatialHash(registry_type& registry, coord_type cell_size)
+        : registry_{&registry}, cell_size_{cell_size} {
+        WECS_ASSERT(cell_size > coord_type{}, "cell size must be positive");
+        registry_->template on_construct<component_type>().template connect<&BasicSpatialHash::insert>(*this);
+        registry_->template on_update<component_type>().template connect<&BasicSpatialHash::move>(*this);
+        registry_->template on_destruction<component_type>().template connect<&BasicSpatialHash::erase>(*this);
+        auto& pool = registry_->template storage<component_type>();
+        for (auto value : pool.packed()) {
+            insert(static_cast<entity_type>(value), pool[static_cast<entity_type>(value)]);
+        }
+    }
+
+    ~BasicSpatialHash() {
+        registry_->template on_construct<component_type>().disconnect(this);
+        registry_->template on_update<component_type>().disconnect(this);
+        registry_->template on_destruction<component_type>().disconnect(this);
+    }
+
+    BasicSpatialHash(const BasicSpatialHash&) = delete;
+    BasicSpatialHash& operator=(const BasicSpatialHash&) = delete;
+
+    //! @brief entities within radius of (x, y), appended to out
+    void query(coord_type x, coord_type y, coord_type radius, std::vector<entity_type>& out) const {
+        const auto squared = radius * radius;
+        const auto [min_x, min_y] = cell_of(x - radius, y - radius);
+        const auto [max_x, max_y] = cell_of(x + radius, y + radius);
+        for (auto cx = min_x; cx <= max_x; cx++) {
+            for (auto cy = min_y; cy <= max_y; cy++) {
+                auto it = cells_.find(key(cx, cy));
+                if (it == cells_.end()) {
+                    continue;
+                }
+                const auto& cell = it->second;
+                for (size_t i = 0; i < cell.entities.size(); i++) {
+                    const auto dx = cell.points[i][0] - x;
+                    const auto dy = cell.points[i][1] - y;
+                    if (dx * dx + dy * dy <= squared) {
+                        out.push_back(cell.entities[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    //! @brief entities within radius of (x, y), e.g. to pass on to registry.view(first, last)
+    std::vector<entity_type> query(coord_type x, coord_type y, coord_type radius) const {
+        std::vector<entity_type> out;
+        query(x, y, radius, out);
+        return out;
+    }
+
+    //! @brief re-read the position of entity, after writes the signals didn't see
+    void refresh(entity_type entity) {
+        move(entity, registry_->template get<component_type>(entity));
+    }
+
+    void refresh() {
+        auto& pool = registry_->template storage<component_type>();
+        for (auto value : pool.packed()) {
+            refresh(static_cast<entity_type>(value));
+        }
+    }
+
+public:
+    size_t size() const noexcept {
+        return slots_.size();
+    }
+
+    coord_type cell_size() const noexcept {
+        return cell_size_;
+    }
+
+    const auto& cells() const noexcept { return cells_; }
+
+private:
+    struct Slot {
+        key_type key;
+        size_t pos;
+    };
+
+    std::pair<int32_t, int32_t> cell_of(coord_type x, coord_type y) const noexcept {
+        return {static_cast<int32_t>(std::floor(x / cell_size_)), static_cast<int32_t>(std::floor(y / cell_size_))};
+    }
+
+    static key_type key(int32_t cx, int32_t cy) noexcept {
+        return static_cast<key_type>(static_cast<uint32_t>(cx)) << 32u | static_cast<uint32_t>(cy);
+    }
+
+    key_type key_of(const component_type& component) const noexcept {
+        const auto [cx, cy] = cell_of(component.*X, component.*Y);
+        return key(cx, cy);
+    }
+
+    void insert(entity_type entity, const component_type& component) {
+        const auto cell_key = key_of(component);
+        auto& cell = cells_[cell_key];
+        slots_.emplace(entity, Slot{cell_key, cell.entities.size()});
+        cell.entities.push_back(entity);
+        cell.points.push_back({component.*X, component.*Y});
+    }
+
+    void move(entity_type entity, const component_type& component) {
+        auto& slot = slots_[entity];
+        if (slot.key == key_of(component)) {
+            cells_[slot.key].points[slot.pos] = {component.*X, component.*Y};
+        } else {
+            erase(entity, component);
+            insert(entity, component);
+        }
+    }
+
+    // swap and pop within the cell, dropping cells left empty
+    void erase(entity_type entity, const component_type&) {
+        const auto slot = slots_[entity];
+        auto it = cells_.find(slot.key);
+        auto& cell = it->second;
+        const auto last = cell.entities.back();
+        cell.entities[slot.pos] = last;
+        cell.points[slot.pos] = cell.points.back();
+        slots_[last].pos = slot.pos;
+        cell.entities.pop_back();
+        cell.points.pop_back();
+        if (cell.entities.empty()) {
+            cells_.erase(it);
+        }
+        slots_.remove(entity);
+    }
+
+private:
+    registry_type* registry_;
+    coord_type cell_size_;
+    std::unordered_map<key_type, Cell> cells_;
+    BasicStorage<EntityType, Slot, PageSize, std::allocator<Slot>> slots_;
+};
+
+} // namespace wecs
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "wecs/config/config.hpp"
+#include <ostream>
+#include <vector>
+
+namespace wecs {
+
+struct MemoryUsage {
+    struct Part {
+        size_t reserved{};
+        size_t used{};
+
+        Part& operator+=(const Part& other) noexcept {
+            reserved += other.reserved;
+            used += other.used;
+            return *this;
+        }
+    };
+
+    Part sparse;
+    Part packed;
+    Part payload;
+    Part signals;
+
+    size_t reserved() const noexcept {
+        return sparse.reserved + packed.reserved + payload.reserved + signals.reserved;
+    }
+
+    size_t used() const noexcept {
+        return sparse.used + packed.used + payload.used + signals.used;
+    }
+
+    MemoryUsage& operator+=(const MemoryUsage& other) noexcept {
+        sparse += other.sparse;
+        packed += other.packed;
+        payload += other.payload;
+        signals += other.signals;
+        return *this;
+    }
+};
+
+struct PoolStats {
+    config::id_type id{};
+    size_t emplace{};
+    size_t remove{};
+    size_t patch{};
+    size_t page_allocations{};
+    size_t sparse_pages{};
+    size_t sparse_bytes{};
+    size_t size{};
+    size_t peak_size{};
+};
+
+struct ViewStats {
+    std::vector<config::id_type> components;
+    size_t constructions{};
+    size_t iterations{};
+};
+
+struct RegistryStats {
+    size_t entities{};
+    size_t peak_entities{};
+    std::vector<PoolStats> pools;
+    std::vector<ViewStats> views;
+
+    void dump(std::ostream& os) const {
+        os << "entities: " << entities << " (peak " << peak_entities << ")\n";
+        for (auto& pool : pools) {
+            os << "pool " << pool.id << ": size " << pool.size << " (peak " << pool.peak_size << ")"
+               << ", emplace " << pool.emplace << ", remove " << pool.remove << ", patch " << pool.patch
+               << ", page allocations " << pool.page_allocations << ", sparse pages " << pool.sparse_pages
+               << " (" << pool.sparse_bytes << " bytes)\n";
+        }
+        for (auto& view : views) {
+            os << "view <";
+            for (size_t i = 0; i < view.components.size(); i++) {
+                os << (i ? ", " : "") << view.components[i];
+            }
+            os << ">: constructions " << view.constructions << ", iterations " << view.iterations << "\n";
+        }
+    }
+};
+
+} // namespace wecs
@@ -3,6 +3,7 @@
 #include "wecs/entity/sparse_set.hpp"
 #include "wecs/entity/component.hpp"
 #include "wecs/config/config.hpp"
+#include <cstring>
 
 namespace wecs {
 
@@ -111,6 +112,8 @@ class BasicStorage : public BasicSparseSet<EntityType, PageSize> {
 public:
     using entity_type = EntityType;
     using payload_type = Payload;
+    using reference = Payload&;
+    using const_reference = const Payload&;
     using allocator_type = Allocator;
     using alloc_traits = std::allocator_traits<allocator_type>;
     using container_type = std::vector<typename alloc_traits::pointer, typename alloc_traits::template rebind_alloc<typename alloc_traits::pointer>>;
@@ -122,10 +125,32 @@ public:
     BasicStorage() {}
     ~BasicStorage() override { clear(); }
 
+    //! @brief copy the pages of other: trivially copyable payloads as raw bytes, others element by element
+    BasicStorage(const BasicStorage& other) : base_type{other}, payload_(other.payload_.get_allocator()) {
+        constexpr auto page_size = component_traits::page_size;
+        const auto size = base_type::size();
+        allocator_type allocator = get_allocator();
+        payload_.reserve((size + page_size - 1u) / page_size);
+        for (size_t page = 0; page * page_size < size; page++) {
+            payload_.push_back(alloc_traits::allocate(allocator, page_size));
+            const auto count = std::min(page_size, size - page * page_size);
+            if constexpr (std::is_trivially_copyable_v<Payload>) {
+                std::memcpy(payload_[page], other.payload_[page], count * sizeof(Payload));
+            } else {
+                for (size_t i = 0; i < count; i++) {
+                    alloc_traits::construct(allocator, payload_[page] + i, other.payload_[page][i]);
+                }
+            }
+        }
+    }
+
+    BasicStorage& operator=(const BasicStorage&) = delete;
+
     template <typename... Args>
     auto& emplace(EntityType value, Args&&... args) {
         WECS_ASSERT(!base_type::contain(value), "entity already exists");
         base_type::insert(value);
+        WECS_STATS(base_type::stats_.emplace++);
         auto index = base_type::index(value);
         return *(new (assure(index)) Payload{std::forward<Args>(args)...});
     }
@@ -136,6 +161,7 @@ public:
         auto index = base_type::index(value);
         auto& elem = element_at(index);
         (std::forward<Func>(func)(elem), ...);
+        WECS_STATS(base_type::stats_.patch++);
         return elem;
     }
 
@@ -148,8 +174,47 @@ public:
         allocator_type allocator = get_allocator();
         alloc_traits::destroy(allocator, std::addressof(other));
         base_type::remove(value);
+        WECS_STATS(base_type::stats_.remove++);
+    }
+
+    void swap_elements(EntityType lhs, EntityType rhs) override {
+        WECS_ASSERT(base_type::contain(lhs) && base_type::contain(rhs), "entity not found");
+        using std::swap;
+        swap(element_at(base_type::index(lhs)), element_at(base_type::index(rhs)));
+        base_type::swap_elements(lhs, rhs);
     }
 
+    //! @brief hint the cache to load the payload of value, reading its sparse slot
+    void prefetch(EntityType value) const noexcept {
+        const auto pos = base_type::index(value);
+        if (pos < base_type::size()) {
+            WECS_PREFETCH(std::addressof(element_at(pos)));
+        }
+    }
+
+    //! @brief call func(entity, payload) for every element, page by page in packed order
+    template <typename Func>
+    void each(Func func) {
+        constexpr auto page_size = component_traits::page_size;
+        const auto* entities = base_type::packed().data();
+        const auto size = base_type::size();
+        for (size_t page = 0; page * page_size < size; page++) {
+            auto* payload = payload_[page];
+            const auto* first = entities + page * page_size;
+            const auto count = std::min(page_size, size - page * page_size);
+            for (size_t i = 0; i < count; i++) {
+                func(static_cast<EntityType>(first[i]), payload[i]);
+            }
+        }
+    }
+
+    const void* value(EntityType value) const override {
+        WECS_ASSERT(base_type::contain(value), "entity not found");
+        return std::addressof(element_at(base_type::index(value)));
+    }
+
+    using base_type::value;
+
 public:
     const_iterator cbegin() const noexcept {
         const auto pos = static_cast<typename iterator::difference_type>(base_type::size());
@@ -187,6 +252,14 @@ public:
         return const_cast<Payload&>(std::as_const(*this).operator[](value));
     }
 
+    //! @brief the payload of value, nullptr if it has none, in a single sparse lookup
+    const Payload* try_get(EntityType value) const noexcept {
+        const auto pos = base_type::index(value);
+        return pos < base_type::size() && base_type::packed()[pos] == to_integral(value)
+                   ? std::addressof(element_at(pos))
+                   : nullptr;
+    }
+
     const_iterator find(EntityType value) noexcept {
         if (base_type::contain(value)) {
             return {&payload_, static_cast<typename iterator::difference_type>(base_type::index(value)) + 1};
@@ -195,15 +268,31 @@ public:
         }
     }
 
-    void clear() noexcept {
+    void clear() noexcept override {
         allocator_type allocator = get_allocator();
         for (auto first = base_type::begin(); !(first.index() < 0); ++first) {
             alloc_traits::destroy(allocator, std::addressof(element_at(static_cast<size_t>(first.index()))));
         }
-        payload_.clear();
+        release_pages(0);
         base_type::clear();
     }
 
+    MemoryUsage memory_usage() const noexcept override {
+        constexpr auto page_size = component_traits::page_size;
+        auto usage = base_type::memory_usage();
+        usage.payload = {payload_.capacity() * sizeof(typename container_type::value_type) + payload_.size() * page_size * sizeof(Payload),
+                         payload_.size() * sizeof(typename container_type::value_type) + base_type::size() * sizeof(Payload)};
+        return usage;
+    }
+
+    //! @brief also release the payload pages past the last element
+    void shrink_to_fit() override {
+        constexpr auto page_size = component_traits::page_size;
+        release_pages((base_type::size() + page_size - 1u) / page_size);
+        payload_.shrink_to_fit();
+        base_type::shrink_to_fit();
+    }
+
 private:
     auto& element_at(const size_t pos) const {
         return payload_[pos / component_traits::page_size][pos % component_traits::page_size];
@@ -219,6 +308,7 @@ private:
             for (size_t i = old; i < payload_.size(); i++) {
                 payload_[i] = alloc_traits::allocate(allocator, page_size);
             }
+            WECS_STATS(base_type::stats_.page_allocations += payload_.size() - old);
         }
         return payload_[idx] + index % page_size;
     }
@@ -227,6 +317,14 @@ private:
         return payload_.get_allocator();
     }
 
+    void release_pages(size_t from) noexcept {
+        allocator_type allocator = get_allocator();
+        for (size_t i = from; i < payload_.size(); i++) {
+            alloc_traits::deallocate(allocator, payload_[i], component_traits::page_size);
+        }
+        payload_.resize(std::min(from, payload_.size()));
+    }
+
 private:
     container_type payload_;
 };
@@ -241,6 +339,8 @@ public:
 
     auto emplace() {
         length_++;
+        WECS_STATS(base_type::stats_.emplace++);
+        WECS_STATS(base_type::stats_.peak_size = std::max(base_type::stats_.peak_size, length_));
         if (length_ <= base_size()) {
             return EntityType{(base_type::packed()[length_ - 1])};
         } else {
@@ -253,6 +353,7 @@ public:
         auto& ref = base_type::swap(value, EntityType{base_type::packed()[length_ - 1]});
         ref = static_cast<typename traits_type::entity_type>(traits_type::next(EntityType{ref}));
         length_--;
+        WECS_STATS(base_type::stats_.remove++);
     }
 
 public:
@@ -268,7 +369,12 @@ public:
         return base_type::size();
     }
 
-    void clear() noexcept {
+    //! @brief the live entity with index entity
+    EntityType current(typename traits_type::entity_type entity) const {
+        return EntityType{base_type::packed()[base_type::index(traits_type::construct(entity, 0))]};
+    }
+
+    void clear() noexcept override {
         base_type::clear();
         length_ = 0;
     }
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "wecs/entity/entity.hpp"
+#include "wecs/entity/stats.hpp"
+#include "wecs/core/access.hpp"
+#include "wecs/config/config.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace wecs {
+
+//! @brief membership of entities in one bit per entity index
+//!
+//! An eighth of a byte per entity index, against the eight bytes of sparse slot
+//! and the packed array of a sparse set. Bits are tested by index only: the
+//! registry checks versions and clears the bits of destroyed entities.
+template <typename EntityType>
+class BasicTagSet {
+public:
+    using entity_type = EntityType;
+    using traits_type = EntityTraits<EntityType>;
+    using word_type = uint64_t;
+    using word_container_type = std::vector<word_type>;
+
+    static constexpr size_t word_bits = sizeof(word_type) * 8u;
+
+    void insert(EntityType value) {
+        const auto pos = static_cast<size_t>(to_entity(value));
+        WECS_ASSERT(!contain(value), "entity already exists");
+        if (pos / word_bits >= words_.size()) {
+            words_.resize(pos / word_bits + 1u);
+        }
+        words_[pos / word_bits] |= bit(pos);
+        size_++;
+    }
+
+    void remove(EntityType value) {
+        WECS_ASSERT(contain(value), "entity not found");
+        const auto pos = static_cast<size_t>(to_entity(value));
+        words_[pos / word_bits] &= ~bit(pos);
+        size_--;
+    }
+
+    bool contain(EntityType value) const noexcept {
+        const auto pos = static_cast<size_t>(to_entity(value));
+        return pos / word_bits < words_.size() && (words_[pos / word_bits] & bit(pos)) != 0u;
+    }
+
+    //! @brief bit i is set when entities[i] is contained, count is at most 32
+    uint32_t contain_mask(const typename traits_type::entity_type* entities, size_t count) const noexcept {
+        WECS_ASSERT(count <= 32, "too many entities");
+        uint32_t mask = 0;
+        for (size_t i = 0; i < count; i++) {
+            mask |= static_cast<uint32_t>(contain(static_cast<EntityType>(entities[i]))) << i;
+        }
+        return mask;
+    }
+
+public:
+    bool empty() const noexcept {
+        return size_ == 0u;
+    }
+
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    //! @brief bit i % word_bits of word i / word_bits is set for the entity with index i
+    const word_container_type& words() const noexcept {
+        return words_;
+    }
+
+    void clear() noexcept {
+        words_.clear();
+        size_ = 0;
+    }
+
+    MemoryUsage memory_usage() const noexcept {
+        MemoryUsage usage;
+        usage.sparse = {words_.capacity() * sizeof(word_type), words_.size() * sizeof(word_type)};
+        return usage;
+    }
+
+    //! @brief release trailing words without entities and unused capacity
+    void shrink_to_fit() {
+        while (!words_.empty() && words_.back() == 0u) {
+            words_.pop_back();
+        }
+        words_.shrink_to_fit();
+    }
+
+#ifdef WECS_ACCESS_CHECK
+    //! @brief held by the registry around writes to this pool
+    AccessChecker& access() const noexcept { return access_; }
+#endif
+
+private:
+    static word_type bit(size_t pos) noexcept {
+        return word_type{1u} << (pos % word_bits);
+    }
+
+private:
+    word_container_type words_;
+    size_t size_ = 0;
+#ifdef WECS_ACCESS_CHECK
+    mutable AccessChecker access_;
+#endif
+};
+
+//! @brief pool of an empty component, chosen by the registry for types with a page_size of 0
+//!
+//! Holds no payload: every access yields a fresh Tag. Tags don't emit signals.
+template <typename EntityType, typename Tag>
+class BasicTagStorage final : public BasicTagSet<EntityType> {
+public:
+    using base_type = BasicTagSet<EntityType>;
+    using entity_type = EntityType;
+    using payload_type = Tag;
+    using reference = Tag;
+    using const_reference = Tag;
+
+    template <typename... Args>
+    Tag emplace(EntityType value, Args&&... args) {
+        base_type::insert(value);
+        return Tag{std::forward<Args>(args)...};
+    }
+
+    //! @brief func is applied to a temporary Tag, there being nothing to write back
+    template <typename... Func>
+    Tag patch([[maybe_unused]] EntityType value, Func&&... func) {
+        WECS_ASSERT(base_type::contain(value), "entity not found");
+        Tag tag{};
+        (std::forward<Func>(func)(tag), ...);
+        return tag;
+    }
+
+    Tag operator[](EntityType) const noexcept {
+        return Tag{};
+    }
+
+    //! @brief a shared Tag if value is marked, nullptr otherwise
+    const Tag* try_get(EntityType value) const noexcept {
+        return base_type::contain(value) ? &instance_ : nullptr;
+    }
+
+    void prefetch_index(EntityType) const noexcept {}
+    void prefetch(EntityType) const noexcept {}
+
+private:
+    inline static const Tag instance_{};
+};
+
+} // namespace wecs
@@ -2,6 +2,9 @@
 
 #include "wecs/core/utility.hpp"
 #include "wecs/core/type_list.hpp"
+#include "wecs/entity/component.hpp"
+#include "wecs/config/config.hpp"
+#include <algorithm>
 
 namespace wecs {
 
@@ -19,6 +22,11 @@ struct ViewIterator {
     ViewIterator(pool_container_type pools, const entity_container_type& entities, size_type offset)
         : pools_{pools}, entities_{entities}, offset_{offset} {}
 
+#ifdef WECS_ENABLE_STATS
+    ViewIterator(pool_container_type pools, const entity_container_type& entities, size_type offset, size_t* iterations)
+        : pools_{pools}, entities_{entities}, offset_{offset}, iterations_{iterations} {}
+#endif
+
     ViewIterator& operator++() { return --offset_, *this; }
 
     ViewIterator& operator--() { return ++offset_, *this; }
@@ -60,12 +68,12 @@ struct ViewIterator {
     }
 
     auto operator*() noexcept {
+        WECS_STATS(if (iterations_) { ++*iterations_; })
         auto entity = entities_[offset_ - 1];
         return std::apply([&entity](auto*... pool) {
-            return std::tuple_cat(
-                std::make_tuple(static_cast<entity_type>(entity)),
-                std::forward_as_tuple((*pool)[static_cast<entity_type>(entity)])...
-            );
+            const auto value = static_cast<entity_type>(entity);
+            // references for plain storages, proxies by value for BasicSoaStorage
+            return std::tuple<entity_type, decltype((*pool)[value])...>(value, (*pool)[value]...);
         }, pools_);
     }
 
@@ -73,10 +81,22 @@ private:
     pool_container_type pools_;
     entity_container_type entities_;
     size_type offset_;
+    WECS_STATS(size_t* iterations_ = nullptr;)
 };
 
 } // namespace internal
 
+template <typename... Types>
+struct Require : TypeList<Types...> {};
+
+//! @brief components an observer's or a view's entities must not have,
+//! e.g. registry.view<Position>(exclude<Stunned>)
+template <typename... Types>
+struct Exclude : TypeList<Types...> {};
+
+template <typename... Types>
+inline constexpr Exclude<Types...> exclude{};
+
 template <typename EntityType, typename Registry, typename... Types>
 class View {
 public:
@@ -107,9 +127,20 @@ public:
         return entities_.empty();
     }
 
+#ifdef WECS_ENABLE_STATS
+    iterator begin() noexcept {
+        return iterator{pools_, entities_, entities_.size(), iterations_};
+    }
+
+    //! @brief count every dereferenced entity into iterations
+    void bind_stats(size_t* iterations) noexcept {
+        iterations_ = iterations;
+    }
+#else
     iterator begin() noexcept {
         return iterator{pools_, entities_, entities_.size()};
     }
+#endif
 
     iterator end() noexcept {
         return iterator{pools_, entities_, 0};
@@ -117,9 +148,74 @@ public:
 
     auto& entities() const noexcept { return entities_; }
 
+    //! @brief call func(entity, components...) for every entity, in the order of the iterators
+    //!
+    //! Looks ahead while walking: the sparse slots of the entity WECS_PREFETCH_DISTANCE * 2
+    //! steps away and the components of the one WECS_PREFETCH_DISTANCE away are prefetched,
+    //! so pools whose packed order differs from the view's don't stall on every lookup.
+    template <typename Func>
+    void each(Func func) {
+        constexpr size_t distance = WECS_PREFETCH_DISTANCE;
+        WECS_STATS(if (iterations_) { *iterations_ += entities_.size(); })
+        for (auto pos = entities_.size(); pos-- > 0;) {
+            if (pos >= 2 * distance) {
+                prefetch_index(static_cast<entity_type>(entities_[pos - 2 * distance]));
+            }
+            if (pos >= distance) {
+                prefetch(static_cast<entity_type>(entities_[pos - distance]));
+            }
+            const auto entity = static_cast<entity_type>(entities_[pos]);
+            std::apply([&func, entity](auto*... pool) { func(entity, (*pool)[entity]...); }, pools_);
+        }
+    }
+
+public:
+    //! @brief keep the entities whose Type changed at tick since or later
+    template <typename Type>
+    View& changed(config::tick_type since) & {
+        return filter<Type>(since, [](const auto& pool, auto entity) { return pool.changed(entity); });
+    }
+
+    template <typename Type>
+    View changed(config::tick_type since) && {
+        return std::move(changed<Type>(since));
+    }
+
+    //! @brief keep the entities whose Type was emplaced at tick since or later
+    template <typename Type>
+    View& added(config::tick_type since) & {
+        return filter<Type>(since, [](const auto& pool, auto entity) { return pool.added(entity); });
+    }
+
+    template <typename Type>
+    View added(config::tick_type since) && {
+        return std::move(added<Type>(since));
+    }
+
+private:
+    void prefetch_index(entity_type entity) const noexcept {
+        std::apply([entity](auto*... pool) { (pool->prefetch_index(entity), ...); }, pools_);
+    }
+
+    void prefetch(entity_type entity) const noexcept {
+        std::apply([entity](auto*... pool) { (pool->prefetch(entity), ...); }, pools_);
+    }
+
+    template <typename Type, typename Func>
+    View& filter(config::tick_type since, Func func) {
+        static_assert(ComponentTraits<std::remove_const_t<Type>>::track_ticks, "component doesn't track ticks");
+        const auto* pool = std::get<typename StorageFor<Type>::type>(pools_);
+        auto last = std::remove_if(entities_.begin(), entities_.end(), [&](auto entity) {
+            return func(*pool, static_cast<entity_type>(entity)) < since;
+        });
+        entities_.erase(last, entities_.end());
+        return *this;
+    }
+
 private:
     pool_container_type pools_;
     entity_container_type entities_;
+    WECS_STATS(size_t* iterations_ = nullptr;)
 };
 
 } // namespace wecs
\ No newline at end of file
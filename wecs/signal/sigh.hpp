@@ -42,6 +42,10 @@ public:
         return delegates_.empty();
     }
 
+    size_t capacity() const noexcept {
+        return delegates_.capacity();
+    }
+
     void clear() noexcept {
         delegates_.clear();
     }
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "wecs/system/scheduler.hpp"
+#include "wecs/entity/fwd.hpp"
+
+namespace wecs {
+
+using scheduler = BasicScheduler<registry>;
+
+} // namespace wecs
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "wecs/system/thread_pool.hpp"
+#include "wecs/core/type_list.hpp"
+#include "wecs/config/config.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace wecs {
+
+template <typename... Types>
+struct Reads : TypeList<Types...> {};
+
+template <typename... Types>
+struct Writes : TypeList<Types...> {};
+
+//! @brief runs systems on a thread pool, ordering those whose component access conflicts
+//!
+//! Systems are kept in registration order. A system waits for every earlier
+//! system that writes a component it reads or writes, or reads a component it
+//! writes; all others run concurrently.
+template <typename Registry>
+class BasicScheduler {
+public:
+    using registry_type = Registry;
+    using function_type = std::function<void(registry_type&)>;
+    using id_type = config::id_type;
+
+    explicit BasicScheduler(registry_type& registry, size_t threads = std::thread::hardware_concurrency())
+        : registry_{&registry}, pool_{threads} {}
+
+    template <typename Read = Reads<>, typename Write = Writes<>, typename Func>
+    BasicScheduler& add(Func func) {
+        System system{function_type{std::move(func)}, ids(Read{}), ids(Write{}), {}, {}};
+        systems_.push_back(std::move(system));
+        dirty_ = true;
+        return *this;
+    }
+
+    void clear() noexcept {
+        systems_.clear();
+        dirty_ = true;
+    }
+
+    //! @brief run every system once, returning when all of them finished
+    void run() {
+        if (systems_.empty()) {
+            return;
+        }
+        if (dirty_) {
+            build();
+        }
+        remaining_.store(systems_.size());
+        for (auto& system : systems_) {
+            system.pending.store(system.dependencies);
+        }
+        for (size_t i = 0; i < systems_.size(); i++) {
+            if (systems_[i].dependencies == 0) {
+                submit(i);
+            }
+        }
+        std::unique_lock lock{mutex_};
+        done_.wait(lock, [this] { return remaining_.load() == 0; });
+    }
+
+public:
+    size_t size() const noexcept {
+        return systems_.size();
+    }
+
+    //! @brief indices of the systems waiting for system pos
+    const std::vector<size_t>& successors(size_t pos) {
+        if (dirty_) {
+            build();
+        }
+        return systems_[pos].successors;
+    }
+
+private:
+    struct System {
+        function_type func;
+        std::vector<id_type> reads;
+        std::vector<id_type> writes;
+        std::vector<size_t> successors;
+        size_t dependencies{};
+        std::atomic<size_t> pending{};
+
+        System(function_type func, std::vector<id_type> reads, std::vector<id_type> writes,
+               std::vector<size_t> successors, size_t dependencies)
+            : func{std::move(func)}, reads{std::move(reads)}, writes{std::move(writes)},
+              successors{std::move(successors)}, dependencies{dependencies} {}
+
+        System(System&& other) noexcept
+            : func{std::move(other.func)}, reads{std::move(other.reads)}, writes{std::move(other.writes)},
+              successors{std::move(other.successors)}, dependencies{other.dependencies} {}
+    };
+
+    template <typename... Types>
+    std::vector<id_type> ids(TypeList<Types...>) {
+        // pools must exist before systems touch the registry concurrently
+        (registry_->template storage<Types>(), ...);
+        std::vector<id_type> ids{Registry::component_ident::template get<Types>()...};
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    static bool intersect(const std::vector<id_type>& lhs, const std::vector<id_type>& rhs) {
+        auto first = lhs.begin();
+        auto second = rhs.begin();
+        while (first != lhs.end() && second != rhs.end()) {
+            if (*first < *second) {
+                ++first;
+            } else if (*second < *first) {
+                ++second;
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool conflict(const System& lhs, const System& rhs) {
+        return intersect(lhs.writes, rhs.writes) || intersect(lhs.writes, rhs.reads) ||
+               intersect(lhs.reads, rhs.writes);
+    }
+
+    void build() {
+        for (auto& system : systems_) {
+            system.successors.clear();
+            system.dependencies = 0;
+        }
+        for (size_t i = 0; i < systems_.size(); i++) {
+            for (size_t j = i + 1; j < systems_.size(); j++) {
+                if (conflict(systems_[i], systems_[j])) {
+                    systems_[i].successors.push_back(j);
+                    systems_[j].dependencies++;
+                }
+            }
+        }
+        dirty_ = false;
+    }
+
+    void submit(size_t pos) {
+        pool_.submit([this, pos] {
+            auto& system = systems_[pos];
+            system.func(*registry_);
+            for (auto next : system.successors) {
+                if (systems_[next].pending.fetch_sub(1) == 1) {
+                    submit(next);
+                }
+            }
+            if (remaining_.fetch_sub(1) == 1) {
+                std::lock_guard lock{mutex_};
+                done_.notify_all();
+            }
+        });
+    }
+
+private:
+    registry_type* registry_;
+    std::vector<System> systems_;
+    bool dirty_ = false;
+    std::atomic<size_t> remaining_{};
+    std::mutex mutex_;
+    std::condition_variable done_;
+    ThreadPool pool_;
+};
+
+} // namespace wecs
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace wecs {
+
+class ThreadPool {
+public:
+    using task_type = std::function<void()>;
+
+    explicit ThreadPool(size_t count = std::thread::hardware_concurrency()) {
+        count = count ? count : 1;
+        workers_.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            workers_.emplace_back([this] { work(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard lock{mutex_};
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(task_type task) {
+        {
+            std::lock_guard lock{mutex_};
+            tasks_.push(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    size_t size() const noexcept {
+        return workers_.size();
+    }
+
+private:
+    void work() {
+        while (true) {
+            task_type task;
+            {
+                std::unique_lock lock{mutex_};
+                cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+            task();
+        }
+    }
+
+private:
+    std::vector<std::thread> workers_;
+    std::queue<task_type> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+};
+
+} // namespace wecs
@@ -2,6 +2,7 @@
 
 #include "wecs/entity/fwd.hpp"
 #include "wecs/signal/fwd.hpp"
+#include "wecs/system/fwd.hpp"
 
 namespace wecs {
 